@@ -33,6 +33,7 @@
 #include "Engine/Module.hpp"
 #include "Engine/ModuleManager.hpp"
 #include "Engine/ModuleUpdater.hpp"
+#include "Engine/Profiler.hpp"
 #include "Events/EventChange.hpp"
 #include "Events/Events.hpp"
 #include "Events/EventStandard.hpp"
@@ -60,6 +61,7 @@
 //#include "Helpers/dirent.h"
 #include "Helpers/FileSystem.hpp"
 #include "Helpers/String.hpp"
+#include "Helpers/TypeIds.hpp"
 #include "Inputs/AxisButton.hpp"
 #include "Inputs/AxisCompound.hpp"
 #include "Inputs/AxisJoystick.hpp"
@@ -78,6 +80,7 @@
 #include "Materials/Material.hpp"
 #include "Materials/MaterialDefault.hpp"
 #include "Materials/PipelineMaterial.hpp"
+#include "Maths/Batch.hpp"
 #include "Maths/Colour.hpp"
 #include "Maths/Delta.hpp"
 #include "Maths/Interpolation/SmoothFloat.hpp"
@@ -86,6 +89,8 @@
 #include "Maths/Matrix3.hpp"
 #include "Maths/Matrix4.hpp"
 #include "Maths/Quaternion.hpp"
+#include "Maths/RandomStream.hpp"
+#include "Maths/Simd.hpp"
 #include "Maths/Time.hpp"
 #include "Maths/Timer.hpp"
 #include "Maths/Transform.hpp"
@@ -99,6 +104,8 @@
 #include "Maths/Visual/DriverSinwave.hpp"
 #include "Maths/Visual/DriverSlide.hpp"
 #include "Maths/Visual/IDriver.hpp"
+#include "Memory/BlockPool.hpp"
+#include "Memory/FrameArena.hpp"
 #include "Meshes/Mesh.hpp"
 #include "Meshes/MeshRender.hpp"
 #include "Meshes/RendererMeshes.hpp"
@@ -136,6 +143,7 @@
 #include "Particles/ParticleSystem.hpp"
 #include "Particles/ParticleType.hpp"
 #include "Particles/RendererParticles.hpp"
+#include "Physics/Aabb.hpp"
 #include "Physics/Colliders/Collider.hpp"
 #include "Physics/Colliders/ColliderCapsule.hpp"
 #include "Physics/Colliders/ColliderCone.hpp"
@@ -181,6 +189,7 @@
 #include "Renderer/Commands/CommandBuffer.hpp"
 #include "Renderer/Descriptors/Descriptor.hpp"
 #include "Renderer/Descriptors/DescriptorSet.hpp"
+#include "Renderer/FrameSnapshot.hpp"
 #include "Renderer/Handlers/DescriptorsHandler.hpp"
 #include "Renderer/Handlers/PushHandler.hpp"
 #include "Renderer/Handlers/StorageHandler.hpp"
@@ -200,15 +209,21 @@
 #include "Renderer/Swapchain/Swapchain.hpp"
 #include "Resources/Resource.hpp"
 #include "Resources/Resources.hpp"
+#include "Scenes/Archetype.hpp"
+#include "Scenes/BoundingTree.hpp"
 #include "Scenes/Camera.hpp"
 #include "Scenes/Component.hpp"
 #include "Scenes/ComponentRegister.hpp"
 #include "Scenes/Entity.hpp"
+#include "Scenes/EntityCommandBuffer.hpp"
+#include "Scenes/EntityHandle.hpp"
 #include "Scenes/EntityPrefab.hpp"
 #include "Scenes/Scene.hpp"
 #include "Scenes/ScenePhysics.hpp"
 #include "Scenes/Scenes.hpp"
 #include "Scenes/SceneStructure.hpp"
+#include "Scenes/TransformComponent.hpp"
+#include "Scenes/TransformHierarchy.hpp"
 #include "Serialized/Metadata.hpp"
 #include "Shadows/RendererShadows.hpp"
 #include "Shadows/ShadowBox.hpp"
@@ -220,6 +235,8 @@
 //#include "Textures/stb_image.h"
 //#include "Textures/stb_image_write.h"
 #include "Textures/Texture.hpp"
+#include "Threads/Job.hpp"
+#include "Threads/JobSystem.hpp"
 #include "Threads/Thread.hpp"
 #include "Threads/ThreadPool.hpp"
 #include "Uis/Inputs/UiInputButton.hpp"
@@ -2,13 +2,17 @@
 
 #include <cmath>
 #include "Engine/Engine.hpp"
+#include "Maths/Batch.hpp"
 
 namespace acid
 {
 	Animator::Animator(Joint *rootJoint) :
 		m_rootJoint(rootJoint),
 		m_animationTime(Time::ZERO),
-		m_currentAnimation(nullptr)
+		m_currentAnimation(nullptr),
+		m_joints(std::vector<Joint *>()),
+		m_modelTransforms(std::vector<Matrix4>()),
+		m_inverseBindTransforms(std::vector<Matrix4>())
 	{
 	}
 
@@ -86,16 +90,18 @@ namespace acid
 
 	void Animator::ApplyPoseToJoints(const std::map<std::string, Matrix4> &currentPose, Joint &joint, const Matrix4 &parentTransform)
 	{
-		Matrix4 currentLocalTransform = currentPose.find(joint.GetName())->second;
-		Matrix4 currentTransform = parentTransform * currentLocalTransform;
+		m_joints.clear();
+		m_modelTransforms.clear();
+		m_inverseBindTransforms.clear();
+		CalculateModelTransforms(currentPose, joint, parentTransform);
 
-		for (auto &childJoint : joint.GetChildren())
+		// The animated transforms are written over the model-space transforms, which are no longer needed.
+		Batch::Multiply(m_modelTransforms.data(), m_inverseBindTransforms.data(), m_modelTransforms.data(), m_modelTransforms.size());
+
+		for (std::size_t i = 0; i < m_joints.size(); i++)
 		{
-			ApplyPoseToJoints(currentPose, *childJoint, currentTransform);
+			m_joints[i]->SetAnimatedTransform(m_modelTransforms[i]);
 		}
-
-		currentTransform = currentTransform * joint.GetInverseBindTransform();
-		joint.SetAnimatedTransform(currentTransform);
 	}
 
 	void Animator::DoAnimation(Animation *animation)
@@ -103,4 +109,18 @@ namespace acid
 		m_animationTime = Time::ZERO;
 		m_currentAnimation = animation;
 	}
+
+	void Animator::CalculateModelTransforms(const std::map<std::string, Matrix4> &currentPose, Joint &joint, const Matrix4 &parentTransform)
+	{
+		Matrix4 currentLocalTransform = currentPose.find(joint.GetName())->second;
+		Matrix4 currentTransform = parentTransform * currentLocalTransform;
+		m_joints.emplace_back(&joint);
+		m_modelTransforms.emplace_back(currentTransform);
+		m_inverseBindTransforms.emplace_back(joint.GetInverseBindTransform());
+
+		for (auto &childJoint : joint.GetChildren())
+		{
+			CalculateModelTransforms(currentPose, *childJoint, currentTransform);
+		}
+	}
 }
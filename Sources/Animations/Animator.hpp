@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <vector>
 #include "Maths/Time.hpp"
 #include "Animation/Animation.hpp"
 #include "Joint/Joint.hpp"
@@ -29,6 +30,10 @@ namespace acid
 
 		Time m_animationTime;
 		Animation *m_currentAnimation;
+
+		std::vector<Joint *> m_joints;
+		std::vector<Matrix4> m_modelTransforms;
+		std::vector<Matrix4> m_inverseBindTransforms;
 	public:
 		/// <summary>
 		/// Creates a new animator.
@@ -118,6 +123,9 @@ namespace acid
 		/// loaded up to the vertex shader and used to transform the vertices into
 		/// the current pose.
 		/// </para>
+		/// <para>
+		/// The model-space transforms of every joint are found first, then all of them are multiplied with their inverse bind transforms in one batch.
+		/// </para>
 		/// </summary>
 		/// <param name="currentPose"> A map of the local-space transforms for all the joints for the desired pose. The map is indexed by the name of the joint which the transform corresponds to. </param>
 		/// <param name="joint"> The current joint which the pose should be applied to. </param>
@@ -131,5 +139,13 @@ namespace acid
 		/// </summary>
 		/// <param name="animation"> The new animation to carry out. </param>
 		void DoAnimation(Animation *animation);
+	private:
+		/// <summary>
+		/// Appends the model-space transform and inverse bind transform of a joint, and then of its descendants.
+		/// </summary>
+		/// <param name="currentPose"> A map of the local-space transforms for all the joints for the desired pose. </param>
+		/// <param name="joint"> The current joint. </param>
+		/// <param name="parentTransform"> The model-space transform of the parent joint. </param>
+		void CalculateModelTransforms(const std::map<std::string, Matrix4> &currentPose, Joint &joint, const Matrix4 &parentTransform);
 	};
 }
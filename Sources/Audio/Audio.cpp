@@ -22,6 +22,12 @@ namespace acid
 		m_masterGain(1.0f),
 		m_gains(std::map<SoundType, float>())
 	{
+		// A headless engine does not open a device, sounds are created without sources and play nothing.
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		m_alDevice = alcOpenDevice(nullptr);
 		m_alContext = alcCreateContext(m_alDevice, nullptr);
 		alcMakeContextCurrent(m_alContext);
@@ -29,6 +35,11 @@ namespace acid
 
 	Audio::~Audio()
 	{
+		if (m_alContext == nullptr)
+		{
+			return;
+		}
+
 		alcMakeContextCurrent(nullptr);
 		alcDestroyContext(m_alContext);
 		alcCloseDevice(m_alDevice);
@@ -38,7 +49,7 @@ namespace acid
 	{
 		auto camera = Scenes::Get()->GetCamera();
 
-		if (camera == nullptr)
+		if (m_alContext == nullptr || camera == nullptr)
 		{
 			return;
 		}
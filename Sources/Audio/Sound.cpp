@@ -14,7 +14,6 @@ namespace acid
 		m_soundBuffer(SoundBuffer::Create(filename)),
 		m_source(0),
 		m_localTransform(localTransform),
-		m_worldTransform(Transform()),
 		m_position(Vector3()),
 		m_direction(Vector3()),
 		m_velocity(Vector3()),
@@ -22,10 +21,14 @@ namespace acid
 		m_gain(gain),
 		m_pitch(pitch)
 	{
-		alGenSources(1, &m_source);
-		alSourcei(m_source, AL_BUFFER, m_soundBuffer->GetBuffer());
+		// A headless engine has no audio device, the sound keeps its state but has no source and plays nothing.
+		if (!Engine::Get()->IsHeadless())
+		{
+			alGenSources(1, &m_source);
+			alSourcei(m_source, AL_BUFFER, m_soundBuffer->GetBuffer());
 
-		Audio::CheckAl(alGetError());
+			Audio::CheckAl(alGetError());
+		}
 
 		SetGain(gain);
 		SetPitch(pitch);
@@ -38,6 +41,11 @@ namespace acid
 
 	Sound::~Sound()
 	{
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alDeleteSources(1, &m_source);
 		Audio::CheckAl(alGetError());
 	}
@@ -63,6 +71,11 @@ namespace acid
 
 	void Sound::Play(const bool &loop)
 	{
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alSourcei(m_source, AL_LOOPING, loop);
 		alSourcePlay(m_source);
 		Audio::CheckAl(alGetError());
@@ -83,7 +96,7 @@ namespace acid
 
 	void Sound::Resume()
 	{
-		if (IsPlaying())
+		if (m_source == 0 || IsPlaying())
 		{
 			return;
 		}
@@ -107,6 +120,11 @@ namespace acid
 
 	bool Sound::IsPlaying()
 	{
+		if (m_source == 0)
+		{
+			return false;
+		}
+
 		ALenum state;
 		alGetSourcei(m_source, AL_SOURCE_STATE, &state);
 		return state == AL_PLAYING;
@@ -114,18 +132,18 @@ namespace acid
 
 	Transform Sound::GetWorldTransform() const
 	{
-		if (m_localTransform.IsDirty() || GetParent()->GetWorldTransform().IsDirty())
-		{
-			m_worldTransform = GetParent()->GetWorldTransform() * m_localTransform;
-			m_localTransform.SetDirty(false);
-		}
-
-		return m_worldTransform;
+		return GetParent()->GetWorldTransform() * m_localTransform;
 	}
 
 	void Sound::SetPosition(const Vector3 &position)
 	{
 		m_position = position;
+
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alSource3f(m_source, AL_POSITION, m_position.m_x, m_position.m_y, m_position.m_z);
 		Audio::CheckAl(alGetError());
 	}
@@ -133,6 +151,12 @@ namespace acid
 	void Sound::SetDirection(const Vector3 &direction)
 	{
 		m_direction = direction;
+
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alSourcefv(m_source, AL_DIRECTION, m_direction.m_elements);
 		Audio::CheckAl(alGetError());
 	}
@@ -140,6 +164,12 @@ namespace acid
 	void Sound::SetVelocity(const Vector3 &velocity)
 	{
 		m_velocity = velocity;
+
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alSource3f(m_source, AL_VELOCITY, m_velocity.m_x, m_velocity.m_y, m_velocity.m_z);
 		Audio::CheckAl(alGetError());
 	}
@@ -147,6 +177,12 @@ namespace acid
 	void Sound::SetGain(const float &gain)
 	{
 		m_gain = gain;
+
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alSourcef(m_source, AL_GAIN, std::pow(m_gain * Audio::Get()->GetTypeGain(m_type), 2.7183f));
 		Audio::CheckAl(alGetError());
 	}
@@ -154,6 +190,12 @@ namespace acid
 	void Sound::SetPitch(const float &pitch)
 	{
 		m_pitch = pitch;
+
+		if (m_source == 0)
+		{
+			return;
+		}
+
 		alSourcef(m_source, AL_PITCH, m_pitch);
 		Audio::CheckAl(alGetError());
 	}
@@ -20,7 +20,6 @@ namespace acid
 		uint32_t m_source;
 
 		Transform m_localTransform;
-		mutable Transform m_worldTransform;
 		Vector3 m_position;
 		Vector3 m_direction;
 		Vector3 m_velocity;
@@ -7,6 +7,7 @@
 #endif
 #include <cassert>
 #include <fstream>
+#include "Engine/Profiler.hpp"
 #include "Files/Files.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Helpers/String.hpp"
@@ -39,6 +40,13 @@ namespace acid
 		m_filename(filename),
 		m_buffer(0)
 	{
+		// A headless engine has no audio device to upload into.
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
+		ACID_PROFILE_SCOPE("SoundBuffer::Load");
 		std::string fileExt = String::Lowercase(FileSystem::FileSuffix(m_filename));
 
 		if (fileExt == ".wav")
@@ -53,6 +61,11 @@ namespace acid
 
 	SoundBuffer::~SoundBuffer()
 	{
+		if (m_buffer == 0)
+		{
+			return;
+		}
+
 		alDeleteBuffers(1, &m_buffer);
 	}
 
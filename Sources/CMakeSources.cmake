@@ -30,6 +30,7 @@ set(_temp_acid_headers
 		Engine/Module.hpp
 		Engine/ModuleManager.hpp
 		Engine/ModuleUpdater.hpp
+		Engine/Profiler.hpp
 		Events/EventChange.hpp
 		Events/Events.hpp
 		Events/EventStandard.hpp
@@ -57,6 +58,7 @@ set(_temp_acid_headers
 		Helpers/dirent.h
 		Helpers/FileSystem.hpp
 		Helpers/String.hpp
+		Helpers/TypeIds.hpp
 		Inputs/AxisButton.hpp
 		Inputs/AxisCompound.hpp
 		Inputs/AxisJoystick.hpp
@@ -75,6 +77,7 @@ set(_temp_acid_headers
 		Materials/Material.hpp
 		Materials/MaterialDefault.hpp
 		Materials/PipelineMaterial.hpp
+		Maths/Batch.hpp
 		Maths/Colour.hpp
 		Maths/Delta.hpp
 		Maths/Interpolation/SmoothFloat.hpp
@@ -83,6 +86,8 @@ set(_temp_acid_headers
 		Maths/Matrix3.hpp
 		Maths/Matrix4.hpp
 		Maths/Quaternion.hpp
+		Maths/RandomStream.hpp
+		Maths/Simd.hpp
 		Maths/Time.hpp
 		Maths/Timer.hpp
 		Maths/Transform.hpp
@@ -96,6 +101,8 @@ set(_temp_acid_headers
 		Maths/Visual/DriverSinwave.hpp
 		Maths/Visual/DriverSlide.hpp
 		Maths/Visual/IDriver.hpp
+		Memory/BlockPool.hpp
+		Memory/FrameArena.hpp
 		Meshes/Mesh.hpp
 		Meshes/MeshRender.hpp
 		Meshes/RendererMeshes.hpp
@@ -133,6 +140,7 @@ set(_temp_acid_headers
 		Particles/ParticleSystem.hpp
 		Particles/ParticleType.hpp
 		Particles/RendererParticles.hpp
+		Physics/Aabb.hpp
 		Physics/Colliders/Collider.hpp
 		Physics/Colliders/ColliderCapsule.hpp
 		Physics/Colliders/ColliderCone.hpp
@@ -178,6 +186,7 @@ set(_temp_acid_headers
 		Renderer/Commands/CommandBuffer.hpp
 		Renderer/Descriptors/Descriptor.hpp
 		Renderer/Descriptors/DescriptorSet.hpp
+		Renderer/FrameSnapshot.hpp
 		Renderer/Handlers/DescriptorsHandler.hpp
 		Renderer/Handlers/PushHandler.hpp
 		Renderer/Handlers/StorageHandler.hpp
@@ -197,15 +206,21 @@ set(_temp_acid_headers
 		Renderer/Swapchain/Swapchain.hpp
 		Resources/Resource.hpp
 		Resources/Resources.hpp
+		Scenes/Archetype.hpp
+		Scenes/BoundingTree.hpp
 		Scenes/Camera.hpp
 		Scenes/Component.hpp
 		Scenes/ComponentRegister.hpp
 		Scenes/Entity.hpp
+		Scenes/EntityCommandBuffer.hpp
+		Scenes/EntityHandle.hpp
 		Scenes/EntityPrefab.hpp
 		Scenes/Scene.hpp
 		Scenes/ScenePhysics.hpp
 		Scenes/Scenes.hpp
 		Scenes/SceneStructure.hpp
+		Scenes/TransformComponent.hpp
+		Scenes/TransformHierarchy.hpp
 		Serialized/Metadata.hpp
 		Shadows/RendererShadows.hpp
 		Shadows/ShadowBox.hpp
@@ -217,6 +232,8 @@ set(_temp_acid_headers
 		Textures/stb_image.h
 		Textures/stb_image_write.h
 		Textures/Texture.hpp
+		Threads/Job.hpp
+		Threads/JobSystem.hpp
 		Threads/Thread.hpp
 		Threads/ThreadPool.hpp
 		Uis/Inputs/UiInputButton.hpp
@@ -255,6 +272,7 @@ set(_temp_acid_sources
 		Engine/Log.cpp
 		Engine/ModuleManager.cpp
 		Engine/ModuleUpdater.cpp
+		Engine/Profiler.cpp
 		Events/Events.cpp
 		Events/EventStandard.cpp
 		Events/EventTime.cpp
@@ -277,6 +295,7 @@ set(_temp_acid_sources
 		Guis/RendererGuis.cpp
 		Helpers/FileSystem.cpp
 		Helpers/String.cpp
+		Helpers/TypeIds.cpp
 		Inputs/AxisButton.cpp
 		Inputs/AxisCompound.cpp
 		Inputs/AxisJoystick.cpp
@@ -292,6 +311,7 @@ set(_temp_acid_sources
 		Lights/Light.cpp
 		Materials/MaterialDefault.cpp
 		Materials/PipelineMaterial.cpp
+		Maths/Batch.cpp
 		Maths/Colour.cpp
 		Maths/Delta.cpp
 		Maths/Interpolation/SmoothFloat.cpp
@@ -300,6 +320,7 @@ set(_temp_acid_sources
 		Maths/Matrix3.cpp
 		Maths/Matrix4.cpp
 		Maths/Quaternion.cpp
+		Maths/RandomStream.cpp
 		Maths/Time.cpp
 		Maths/Timer.cpp
 		Maths/Transform.cpp
@@ -312,6 +333,8 @@ set(_temp_acid_sources
 		Maths/Visual/DriverLinear.cpp
 		Maths/Visual/DriverSinwave.cpp
 		Maths/Visual/DriverSlide.cpp
+		Memory/BlockPool.cpp
+		Memory/FrameArena.cpp
 		Meshes/Mesh.cpp
 		Meshes/MeshRender.cpp
 		Meshes/RendererMeshes.cpp
@@ -348,6 +371,7 @@ set(_temp_acid_sources
 		Particles/ParticleSystem.cpp
 		Particles/ParticleType.cpp
 		Particles/RendererParticles.cpp
+		Physics/Aabb.cpp
 		Physics/Colliders/Collider.cpp
 		Physics/Colliders/ColliderCapsule.cpp
 		Physics/Colliders/ColliderCone.cpp
@@ -391,6 +415,7 @@ set(_temp_acid_sources
 		Renderer/Buffers/VertexBuffer.cpp
 		Renderer/Commands/CommandBuffer.cpp
 		Renderer/Descriptors/DescriptorSet.cpp
+		Renderer/FrameSnapshot.cpp
 		Renderer/Handlers/DescriptorsHandler.cpp
 		Renderer/Handlers/PushHandler.cpp
 		Renderer/Handlers/StorageHandler.cpp
@@ -405,12 +430,18 @@ set(_temp_acid_sources
 		Renderer/Swapchain/Framebuffers.cpp
 		Renderer/Swapchain/Swapchain.cpp
 		Resources/Resources.cpp
+		Scenes/Archetype.cpp
+		Scenes/BoundingTree.cpp
+		Scenes/Component.cpp
 		Scenes/ComponentRegister.cpp
 		Scenes/Entity.cpp
+		Scenes/EntityCommandBuffer.cpp
 		Scenes/EntityPrefab.cpp
 		Scenes/ScenePhysics.cpp
 		Scenes/Scenes.cpp
 		Scenes/SceneStructure.cpp
+		Scenes/TransformComponent.cpp
+		Scenes/TransformHierarchy.cpp
 		Serialized/Metadata.cpp
 		Shadows/RendererShadows.cpp
 		Shadows/ShadowBox.cpp
@@ -420,6 +451,7 @@ set(_temp_acid_sources
 		Textures/Cubemap.cpp
 		Textures/DepthStencil.cpp
 		Textures/Texture.cpp
+		Threads/JobSystem.cpp
 		Threads/Thread.cpp
 		Threads/ThreadPool.cpp
 		Uis/Inputs/UiInputButton.cpp
@@ -15,10 +15,6 @@ namespace acid
 	{
 	}
 
-	void EmitterCircle::Update()
-	{
-	}
-
 	void EmitterCircle::Decode(const Metadata &metadata)
 	{
 		m_radius = metadata.GetChild<float>("Radius");
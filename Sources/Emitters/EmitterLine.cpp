@@ -16,10 +16,6 @@ namespace acid
 	{
 	}
 
-	void EmitterLine::Update()
-	{
-	}
-
 	void EmitterLine::Decode(const Metadata &metadata)
 	{
 		m_length = metadata.GetChild<float>("Length");
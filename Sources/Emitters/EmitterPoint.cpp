@@ -14,10 +14,6 @@ namespace acid
 	{
 	}
 
-	void EmitterPoint::Update()
-	{
-	}
-
 	void EmitterPoint::Decode(const Metadata &metadata)
 	{
 		m_point = metadata.GetChild<Vector3>("Point");
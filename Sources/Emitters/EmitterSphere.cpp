@@ -16,10 +16,6 @@ namespace acid
 	{
 	}
 
-	void EmitterSphere::Update()
-	{
-	}
-
 	void EmitterSphere::Decode(const Metadata &metadata)
 	{
 		m_radius = metadata.GetChild<float>("Radius");
@@ -8,11 +8,13 @@ namespace acid
 	Engine *Engine::INSTANCE = nullptr;
 	std::chrono::time_point<HighResolutionClock> TIME_START = HighResolutionClock::now();
 
-	Engine::Engine(const bool &emptyRegister) :
+	Engine::Engine(const bool &emptyRegister, const bool &headless) :
+		m_jobSystem(),
 		m_moduleManager(ModuleManager()),
 		m_moduleUpdater(ModuleUpdater()),
 		m_timeOffset(Time::ZERO),
 		m_fpsLimit(-1.0f),
+		m_headless(headless),
 		m_running(true),
 		m_error(false)
 	{
@@ -21,7 +23,7 @@ namespace acid
 
 		if (!emptyRegister)
 		{
-			m_moduleManager.FillRegister();
+			m_moduleManager.FillRegister(m_headless);
 		}
 	}
 
@@ -33,6 +35,7 @@ namespace acid
 			m_moduleUpdater.Update(m_moduleManager);
 		}
 
+		Log::Flush();
 		return EXIT_SUCCESS;
 	}
 
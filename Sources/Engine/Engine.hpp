@@ -4,6 +4,7 @@
 #include <memory>
 #include "Log.hpp"
 #include "Maths/Time.hpp"
+#include "Threads/JobSystem.hpp"
 #include "ModuleManager.hpp"
 #include "ModuleUpdater.hpp"
 
@@ -20,11 +21,13 @@ namespace acid
 	private:
 		static Engine *INSTANCE;
 
+		JobSystem m_jobSystem;
 		ModuleManager m_moduleManager;
 		ModuleUpdater m_moduleUpdater;
 
 		Time m_timeOffset;
 		float m_fpsLimit;
+		bool m_headless;
 		bool m_running;
 		bool m_error;
 	public:
@@ -38,7 +41,8 @@ namespace acid
 		/// Carries out the setup for basic engine components and the engine. Call <seealso cref="#Run()"/> after creating a instance.
 		/// </summary>
 		/// <param name="emptyRegister"> If the module register will start empty. </param>
-		explicit Engine(const bool &emptyRegister = false);
+		/// <param name="headless"> If the engine runs without a display, renderer or audio device, see <seealso cref="#IsHeadless()"/>. </param>
+		explicit Engine(const bool &emptyRegister = false, const bool &headless = false);
 
 		/// <summary>
 		/// The update function for the updater.
@@ -52,6 +56,12 @@ namespace acid
 		/// <returns> The engines module manager. </returns>
 		ModuleManager &GetModuleManager() { return m_moduleManager; }
 
+		/// <summary>
+		/// Gets the job system used by the engine instance. Modules can use it to spread work over all cores.
+		/// </summary>
+		/// <returns> The engines job system. </returns>
+		JobSystem &GetJobSystem() { return m_jobSystem; }
+
 		/// <summary>
 		/// Gets the current time of the engine instance.
 		/// </summary>
@@ -100,6 +110,25 @@ namespace acid
 		/// <returns> The delta between renders. </returns>
 		Time GetDeltaRender() const { return m_moduleUpdater.GetDeltaRender(); }
 
+		/// <summary>
+		/// Gets the time spent updating modules over the last second.
+		/// </summary>
+		/// <returns> The busy time. </returns>
+		Time GetTimeBusy() const { return m_moduleUpdater.GetTimeBusy(); }
+
+		/// <summary>
+		/// Gets the time spent sleeping until the next update or render over the last second.
+		/// </summary>
+		/// <returns> The idle time. </returns>
+		Time GetTimeIdle() const { return m_moduleUpdater.GetTimeIdle(); }
+
+		/// <summary>
+		/// Gets if the engine is headless. A headless engine has no window, renderer or GPU resources, input modules never report input and audio is silent.
+		/// Scenes, physics, events, resources and particles still update, this is used for dedicated servers, simulation workers and benchmarks.
+		/// </summary>
+		/// <returns> If the engine is headless. </returns>
+		bool IsHeadless() const { return m_headless; }
+
 		/// <summary>
 		/// Gets if the engine is running.
 		/// </summary>
@@ -1,30 +1,295 @@
 #include "Log.hpp"
 
+#include <condition_variable>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <thread>
 #include "Helpers/FileSystem.hpp"
 
 namespace acid
 {
-	std::mutex Log::MUTEX = std::mutex();
-	std::ofstream Log::STREAM = std::ofstream();
+	/// <summary>
+	/// A bounded multiple producer single consumer ring of messages, drained by a background thread.
+	/// </summary>
+	class Log::Writer
+	{
+	private:
+		struct Slot
+		{
+			std::atomic<uint64_t> m_sequence;
+			LogLevel m_level;
+			std::string m_string;
+		};
+
+		std::unique_ptr<Slot[]> m_slots;
+		uint64_t m_mask;
+		std::atomic<uint64_t> m_enqueue;
+		std::atomic<uint64_t> m_dequeue;
+		std::atomic<uint64_t> m_dropped;
+		uint64_t m_reported;
+		std::atomic<bool> m_running;
+		std::mutex m_mutex;
+		std::condition_variable m_condition;
+		std::ofstream m_stream;
+		std::thread m_thread;
+	public:
+		explicit Writer(const uint32_t &capacity) :
+			m_slots(std::make_unique<Slot[]>(capacity)),
+			m_mask(capacity - 1),
+			m_enqueue(0),
+			m_dequeue(0),
+			m_dropped(0),
+			m_reported(0),
+			m_running(true),
+			m_mutex(),
+			m_condition(),
+			m_stream(),
+			m_thread()
+		{
+			for (uint32_t i = 0; i < capacity; i++)
+			{
+				m_slots[i].m_sequence.store(i, std::memory_order_relaxed);
+			}
+
+			m_thread = std::thread(&Writer::Run, this);
+		}
+
+		bool Push(const LogLevel &level, std::string &&string)
+		{
+			if (!m_running.load(std::memory_order_acquire))
+			{
+				// The writer thread has stopped at exit, messages are written directly.
+				std::lock_guard<std::mutex> lock(m_mutex);
+				Output(level, string);
+				return true;
+			}
+
+			uint64_t position = m_enqueue.load(std::memory_order_relaxed);
+			Slot *slot;
+
+			for (;;)
+			{
+				slot = &m_slots[position & m_mask];
+				uint64_t sequence = slot->m_sequence.load(std::memory_order_acquire);
+				int64_t difference = static_cast<int64_t>(sequence) - static_cast<int64_t>(position);
+
+				if (difference == 0)
+				{
+					if (m_enqueue.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+					{
+						break;
+					}
+				}
+				else if (difference < 0)
+				{
+					m_dropped.fetch_add(1, std::memory_order_relaxed);
+					return false;
+				}
+				else
+				{
+					position = m_enqueue.load(std::memory_order_relaxed);
+				}
+			}
+
+			slot->m_level = level;
+			slot->m_string = std::move(string);
+			slot->m_sequence.store(position + 1, std::memory_order_release);
+			return true;
+		}
+
+		void Notify()
+		{
+			m_condition.notify_one();
+		}
+
+		void Flush()
+		{
+			uint64_t target = m_enqueue.load(std::memory_order_acquire);
+
+			while (m_running.load(std::memory_order_acquire) && m_dequeue.load(std::memory_order_acquire) < target)
+			{
+				m_condition.notify_one();
+				std::this_thread::yield();
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			fflush(stdout);
+			m_stream.flush();
+		}
+
+		void Stop()
+		{
+			m_running.store(false, std::memory_order_release);
+			m_condition.notify_one();
+
+			if (m_thread.joinable())
+			{
+				m_thread.join();
+			}
+		}
+
+		uint64_t GetDropped() const { return m_dropped.load(std::memory_order_relaxed); }
+
+		void Open(const std::string &filename)
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			FileSystem::Create(filename);
+			m_stream.open(filename);
+		}
+	private:
+		void Run()
+		{
+			while (true)
+			{
+				bool running = m_running.load(std::memory_order_acquire);
+
+				if (!Drain() && running)
+				{
+					std::unique_lock<std::mutex> lock(m_mutex);
+					m_condition.wait_for(lock, std::chrono::milliseconds(10));
+				}
+
+				if (!running)
+				{
+					// One last drain for messages pushed before the writer stopped.
+					Drain();
+					break;
+				}
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			m_stream.flush();
+		}
+
+		bool Drain()
+		{
+			bool drained = false;
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			for (;;)
+			{
+				uint64_t position = m_dequeue.load(std::memory_order_relaxed);
+				auto &slot = m_slots[position & m_mask];
+
+				if (slot.m_sequence.load(std::memory_order_acquire) != position + 1)
+				{
+					break;
+				}
+
+				Output(slot.m_level, slot.m_string);
+				slot.m_string.clear();
+				slot.m_sequence.store(position + m_mask + 1, std::memory_order_release);
+				m_dequeue.store(position + 1, std::memory_order_release);
+				drained = true;
+			}
+
+			if (uint64_t dropped = m_dropped.load(std::memory_order_relaxed); dropped > m_reported)
+			{
+				Output(LOG_LEVEL_WARNING, std::to_string(dropped - m_reported) + " log messages were dropped\n");
+				m_reported = dropped;
+			}
+
+			return drained;
+		}
+
+		void Output(const LogLevel &level, const std::string &string)
+		{
+			fputs(string.c_str(), level == LOG_LEVEL_ERROR ? stderr : stdout);
+			m_stream << string;
+		}
+	};
+
+	const uint32_t Log::QUEUE_CAPACITY = 4096;
+
+	std::atomic<int32_t> Log::LEVEL = LOG_LEVEL_DEBUG;
 
 	void Log::Out(const std::string &string)
 	{
-		std::lock_guard<std::mutex> lock(MUTEX);
-		fprintf(stdout, string.c_str());
-		STREAM << string;
+		if (IsEnabled(LOG_LEVEL_INFO))
+		{
+			Push(LOG_LEVEL_INFO, std::string(string));
+		}
+	}
+
+	void Log::Warning(const std::string &string)
+	{
+		if (IsEnabled(LOG_LEVEL_WARNING))
+		{
+			Push(LOG_LEVEL_WARNING, std::string(string));
+		}
 	}
 
 	void Log::Error(const std::string &string)
 	{
-		std::lock_guard<std::mutex> lock(MUTEX);
-		fprintf(stderr, string.c_str());
-		STREAM << string;
+		if (IsEnabled(LOG_LEVEL_ERROR))
+		{
+			Push(LOG_LEVEL_ERROR, std::string(string));
+			Flush();
+		}
+	}
+
+	void Log::Write(const LogLevel &level, const std::string &message, const std::vector<LogField> &fields)
+	{
+		if (!IsEnabled(level))
+		{
+			return;
+		}
+
+		std::string string = message;
+
+		for (auto &field : fields)
+		{
+			string += " " + field.GetKey() + "=" + field.GetValue();
+		}
+
+		string += "\n";
+		Push(level, std::move(string));
+
+		if (level == LOG_LEVEL_ERROR)
+		{
+			Flush();
+		}
+	}
+
+	void Log::Flush()
+	{
+		GetWriter()->Flush();
+	}
+
+	uint64_t Log::GetDropped()
+	{
+		return GetWriter()->GetDropped();
 	}
 
 	void Log::OpenLog(const std::string &filename)
 	{
-		std::lock_guard<std::mutex> lock(MUTEX);
-		FileSystem::Create(filename);
-		STREAM.open(filename);
+		GetWriter()->Open(filename);
+	}
+
+	void Log::Push(const LogLevel &level, std::string &&string)
+	{
+		auto writer = GetWriter();
+
+		if (writer->Push(level, std::move(string)) && level >= LOG_LEVEL_WARNING)
+		{
+			writer->Notify();
+		}
+	}
+
+	Log::Writer *Log::GetWriter()
+	{
+		// Never destroyed so messages from static destructors are still written, the thread is stopped at exit.
+		static Writer *writer = []()
+		{
+			auto result = new Writer(QUEUE_CAPACITY);
+			std::atexit([]()
+			{
+				GetWriter()->Stop();
+			});
+			return result;
+		}();
+		return writer;
 	}
-}
\ No newline at end of file
+}
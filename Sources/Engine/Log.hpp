@@ -1,28 +1,82 @@
 #pragma once
 
+#include <atomic>
+#include <fstream>
 #include <memory>
 #include <mutex>
-#include <fstream>
 #include <string>
+#include <type_traits>
+#include <vector>
 #include "Exports.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A logging class used in Acid, will write output to a file one the application has closed.
+	/// The severity of a log message, messages below the log level are discarded before they are formatted.
+	/// </summary>
+	enum LogLevel
+	{
+		LOG_LEVEL_DEBUG = 0,
+		LOG_LEVEL_INFO = 1,
+		LOG_LEVEL_WARNING = 2,
+		LOG_LEVEL_ERROR = 3
+	};
+
+	/// <summary>
+	/// A named value attached to a log message, written as key=value after the message.
+	/// </summary>
+	class ACID_EXPORT LogField
+	{
+	private:
+		std::string m_key;
+		std::string m_value;
+	public:
+		LogField(const std::string &key, const std::string &value) :
+			m_key(key),
+			m_value(value)
+		{
+		}
+
+		LogField(const std::string &key, const char *value) :
+			m_key(key),
+			m_value(value)
+		{
+		}
+
+		template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+		LogField(const std::string &key, const T &value) :
+			m_key(key),
+			m_value(std::to_string(value))
+		{
+		}
+
+		const std::string &GetKey() const { return m_key; }
+
+		const std::string &GetValue() const { return m_value; }
+	};
+
+	/// <summary>
+	/// A logging class used in Acid. Messages are queued into a bounded ring and written to the console and log file by a background thread,
+	/// when the ring is full messages are dropped and counted instead of blocking the caller.
 	/// </summary>
 	class ACID_EXPORT Log
 	{
 	private:
-		static std::mutex MUTEX;
-		static std::ofstream STREAM;
+		class Writer;
+
+		static std::atomic<int32_t> LEVEL;
 	public:
+		/// <summary>
+		/// The amount of messages that can be waiting to be written.
+		/// </summary>
+		static const uint32_t QUEUE_CAPACITY;
+
 		/// <summary>
 		/// Outputs a message into the console.
 		/// </summary>
 		/// <param name="string"> The string to output. </param>
 		static void Out(const std::string &string);
-		
+
 		/// <summary>
 		/// Outputs a message into the console.
 		/// </summary>
@@ -31,32 +85,100 @@ namespace acid
 		template<typename... Args>
 		static void Out(const std::string &format, Args &&... args)
 		{
-			Out(StringFormat(format, std::forward<Args>(args)...));
+			if (IsEnabled(LOG_LEVEL_INFO))
+			{
+				Out(StringFormat(format, std::forward<Args>(args)...));
+			}
+		}
+
+		/// <summary>
+		/// Outputs a warning into the console.
+		/// </summary>
+		/// <param name="string"> The string to output. </param>
+		static void Warning(const std::string &string);
+
+		/// <summary>
+		/// Outputs a warning into the console.
+		/// </summary>
+		/// <param name="format"> The format to output into. </param>
+		/// <param name="args"> The args to be added into the format. </param>
+		template<typename... Args>
+		static void Warning(const std::string &format, Args &&... args)
+		{
+			if (IsEnabled(LOG_LEVEL_WARNING))
+			{
+				Warning(StringFormat(format, std::forward<Args>(args)...));
+			}
 		}
 
 		/// <summary>
-		/// Outputs a error into the console.
+		/// Outputs a error into the console, waits for the message to be written so it is not lost if the application crashes.
 		/// </summary>
 		/// <param name="string"> The string to output. </param>
 		static void Error(const std::string &string);
-		
+
 		/// <summary>
-		/// Outputs a error into the console.
+		/// Outputs a error into the console, waits for the message to be written so it is not lost if the application crashes.
 		/// </summary>
 		/// <param name="format"> The format to output into. </param>
 		/// <param name="args"> The args to be added into the format. </param>
 		template<typename... Args>
 		static void Error(const std::string &format, Args &&... args)
 		{
-			Error(StringFormat(format, std::forward<Args>(args)...));
+			if (IsEnabled(LOG_LEVEL_ERROR))
+			{
+				Error(StringFormat(format, std::forward<Args>(args)...));
+			}
 		}
 
+		/// <summary>
+		/// Outputs a message with structured fields, the message is written followed by each field as key=value.
+		/// </summary>
+		/// <param name="level"> The severity of the message. </param>
+		/// <param name="message"> The message to output. </param>
+		/// <param name="fields"> The fields to add after the message. </param>
+		static void Write(const LogLevel &level, const std::string &message, const std::vector<LogField> &fields);
+
+		/// <summary>
+		/// Gets if messages of a severity will be written.
+		/// </summary>
+		/// <param name="level"> The severity to check. </param>
+		/// <returns> If the severity is enabled. </returns>
+		static bool IsEnabled(const LogLevel &level) { return level >= LEVEL.load(std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Gets the lowest severity that will be written.
+		/// </summary>
+		/// <returns> The log level. </returns>
+		static LogLevel GetLevel() { return static_cast<LogLevel>(LEVEL.load(std::memory_order_relaxed)); }
+
+		/// <summary>
+		/// Sets the lowest severity that will be written.
+		/// </summary>
+		/// <param name="level"> The log level. </param>
+		static void SetLevel(const LogLevel &level) { LEVEL.store(level, std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Waits for every queued message to be written.
+		/// </summary>
+		static void Flush();
+
+		/// <summary>
+		/// Gets the amount of messages that were dropped because the queue was full.
+		/// </summary>
+		/// <returns> The dropped message count. </returns>
+		static uint64_t GetDropped();
+
 		/// <summary>
 		/// Sets a fule to output all log messages into.
 		/// </summary>
 		/// <param name="filename"> The filename to output into. </param>
 		static void OpenLog(const std::string &filename);
 	private:
+		static void Push(const LogLevel &level, std::string &&string);
+
+		static Writer *GetWriter();
+
 		template<typename... Args>
 		static std::string StringFormat(const std::string &format, Args &&... args)
 		{
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <typeindex>
+#include <vector>
+#include "Maths/Time.hpp"
 #include "Exports.hpp"
 
 namespace acid
@@ -21,10 +24,44 @@ namespace acid
 	/// </summary>
 	class ACID_EXPORT Module
 	{
+	private:
+		friend class ModuleManager;
+
+		std::vector<std::type_index> m_reads;
+		std::vector<std::type_index> m_writes;
 	public:
+		virtual ~Module() = default;
+
 		/// <summary>
 		/// The update function for the module.
 		/// </summary>
 		virtual void Update() = 0;
+
+		/// <summary>
+		/// Gets the amount of time until this module next needs to update, the engine sleeps until the closest time.
+		/// Modules that only react to the update and render ticks return infinity.
+		/// </summary>
+		/// <returns> The time until the module needs to update. </returns>
+		virtual Time GetTimeUntilUpdate() { return Time::POSITIVE_INFINITY; }
+
+		/// <summary>
+		/// Gets if this module has declared what data it reads and writes. Modules that have not declared access never update in parallel with other modules.
+		/// </summary>
+		/// <returns> If the module declared its access. </returns>
+		bool IsAccessDeclared() const { return !m_reads.empty() || !m_writes.empty(); }
+	protected:
+		/// <summary>
+		/// Declares that this modules update reads data owned by a type, usually another module.
+		/// </summary>
+		/// <param name="T"> The type that is read. </param>
+		template<typename T>
+		void Reads() { m_reads.emplace_back(typeid(T)); }
+
+		/// <summary>
+		/// Declares that this modules update writes data owned by a type, usually the module itself.
+		/// </summary>
+		/// <param name="T"> The type that is written. </param>
+		template<typename T>
+		void Writes() { m_writes.emplace_back(typeid(T)); }
 	};
 }
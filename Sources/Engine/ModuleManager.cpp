@@ -1,11 +1,17 @@
 #include "ModuleManager.hpp"
 
+#include <algorithm>
+#include <cmath>
+#include <queue>
+#include "Engine.hpp"
 #include "Log.hpp"
+#include "Profiler.hpp"
 #include "Audio/Audio.hpp"
 #include "Display/Display.hpp"
 #include "Events/Events.hpp"
 #include "Files/Files.hpp"
 #include "Gizmos/Gizmos.hpp"
+#include "Helpers/TypeIds.hpp"
 #include "Inputs/Joysticks.hpp"
 #include "Inputs/Keyboard.hpp"
 #include "Inputs/Mouse.hpp"
@@ -20,26 +26,51 @@ namespace acid
 {
 	ModuleManager::ModuleManager() :
 		m_mutex(std::mutex()),
-		m_modules(std::map<float, std::unique_ptr<Module>>())
+		m_modules(std::map<float, std::unique_ptr<Module>>()),
+		m_typeModules(std::vector<Module *>()),
+		m_dependencies(std::vector<std::pair<Module *, Module *>>()),
+		m_stages(std::map<ModuleUpdate, std::vector<std::vector<Module *>>>()),
+		m_stagesDirty(true)
 	{
 	}
 
-	void ModuleManager::FillRegister()
+	ModuleManager::~ModuleManager()
 	{
-		Add<Display>(MODULE_UPDATE_POST);
+		// Destroys modules in the reverse order they update, modules can still get the modules they depend on while being destroyed.
+		for (auto it = m_modules.rbegin(); it != m_modules.rend(); ++it)
+		{
+			auto module = (*it).second.get();
+			(*it).second.reset();
+			std::replace(m_typeModules.begin(), m_typeModules.end(), module, static_cast<Module *>(nullptr));
+		}
+	}
+
+	void ModuleManager::FillRegister(const bool &headless)
+	{
+		// The display is added first, input modules register their callbacks on its window.
+		if (!headless)
+		{
+			Add<Display>(MODULE_UPDATE_POST);
+		}
+
+		// Input and audio are still added when headless so they can be queried, they never report input and play nothing.
 		Add<Joysticks>(MODULE_UPDATE_PRE);
 		Add<Keyboard>(MODULE_UPDATE_PRE);
 		Add<Mouse>(MODULE_UPDATE_PRE);
 		Add<Audio>(MODULE_UPDATE_PRE);
 		Add<Files>(MODULE_UPDATE_PRE);
 		Add<Scenes>(MODULE_UPDATE_NORMAL);
-		Add<Gizmos>(MODULE_UPDATE_NORMAL);
-		Add<Renderer>(MODULE_UPDATE_RENDER);
 		Add<Resources>(MODULE_UPDATE_PRE);
 		Add<Events>(MODULE_UPDATE_ALWAYS);
-		Add<Uis>(MODULE_UPDATE_PRE);
 		Add<Particles>(MODULE_UPDATE_NORMAL);
-		Add<Shadows>(MODULE_UPDATE_NORMAL);
+
+		if (!headless)
+		{
+			Add<Gizmos>(MODULE_UPDATE_NORMAL);
+			Add<Renderer>(MODULE_UPDATE_RENDER);
+			Add<Uis>(MODULE_UPDATE_PRE);
+			Add<Shadows>(MODULE_UPDATE_NORMAL);
+		}
 	}
 
 	bool ModuleManager::Contains(Module *module)
@@ -58,6 +89,16 @@ namespace acid
 	}
 
 	Module *ModuleManager::Add(Module *module, const ModuleUpdate &update)
+	{
+		if (module == nullptr)
+		{
+			return nullptr;
+		}
+
+		return Add(module, update, GetTypeId(typeid(*module)));
+	}
+
+	Module *ModuleManager::Add(Module *module, const ModuleUpdate &update, const uint32_t &typeId)
 	{
 		if (Contains(module))
 		{
@@ -68,25 +109,76 @@ namespace acid
 		std::lock_guard<std::mutex> lock(m_mutex);
 		float key = static_cast<float>(update) + (0.01f * static_cast<float>(m_modules.size()));
 		m_modules.emplace(key, module);
+		m_stagesDirty = true;
+
+		if (typeId >= m_typeModules.size())
+		{
+			m_typeModules.resize(typeId + 1, nullptr);
+		}
+
+		m_typeModules[typeId] = module;
 		return module;
 	}
 
+	void ModuleManager::AddDependency(Module *module, Module *dependency)
+	{
+		if (module == nullptr || dependency == nullptr || module == dependency)
+		{
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		m_dependencies.emplace_back(module, dependency);
+		m_stagesDirty = true;
+	}
+
 	void ModuleManager::Remove(Module *module)
 	{
+		if (module == nullptr)
+		{
+			return;
+		}
+
 		std::lock_guard<std::mutex> lock(m_mutex);
+		m_stagesDirty = true;
+
+		m_dependencies.erase(std::remove_if(m_dependencies.begin(), m_dependencies.end(), [module](const std::pair<Module *, Module *> &dependency)
+		{
+			return dependency.first == module || dependency.second == module;
+		}), m_dependencies.end());
+
+		std::replace(m_typeModules.begin(), m_typeModules.end(), module, static_cast<Module *>(nullptr));
 
-		for (auto it = --m_modules.end(); it != m_modules.begin(); --it)
+		for (auto it = m_modules.begin(); it != m_modules.end(); ++it)
 		{
-			if ((*it).second.get() != module)
+			if ((*it).second.get() == module)
 			{
-				continue;
+				m_modules.erase(it);
+				break;
 			}
+		}
+	}
+
+	uint32_t ModuleManager::GetTypeId(const std::type_index &type)
+	{
+		return TypeIds::Get(typeid(Module), type);
+	}
+
+	Time ModuleManager::GetTimeUntilUpdate() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
 
-			m_modules.erase(it);
+		Time result = Time::POSITIVE_INFINITY;
+
+		for (auto &[key, module] : m_modules)
+		{
+			result = std::min(result, module->GetTimeUntilUpdate());
 		}
+
+		return result;
 	}
 
-	void ModuleManager::RunUpdate(const ModuleUpdate &update)
+	bool ModuleManager::HasModules(const ModuleUpdate &update) const
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
@@ -94,8 +186,212 @@ namespace acid
 		{
 			if (static_cast<int32_t>(std::floor(key)) == update)
 			{
-				module->Update();
+				return true;
 			}
 		}
+
+		return false;
+	}
+
+	static void UpdateModule(Module *module)
+	{
+		ACID_PROFILE_SCOPE(Profiler::GetTypeName(typeid(*module)));
+		module->Update();
+	}
+
+	void ModuleManager::RunUpdate(const ModuleUpdate &update)
+	{
+#if defined(ACID_PROFILER)
+		static const char *STAGE_NAMES[] = {"Update Always", "Update Pre", "Update Normal", "Update Post", "Update Render"};
+#endif
+		ACID_PROFILE_SCOPE(STAGE_NAMES[update]);
+		std::vector<std::vector<Module *>> levels;
+
+		// The stage is copied out so modules can add or remove modules from their update without deadlocking.
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+
+			if (m_stagesDirty)
+			{
+				m_stages.clear();
+				m_stagesDirty = false;
+			}
+
+			auto it = m_stages.find(update);
+
+			if (it == m_stages.end())
+			{
+				it = m_stages.emplace(update, BuildStage(update)).first;
+			}
+
+			levels = (*it).second;
+		}
+
+		for (auto &level : levels)
+		{
+			// A module removed by an earlier level is no longer updated.
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+
+				if (m_stagesDirty)
+				{
+					level.erase(std::remove_if(level.begin(), level.end(), [this](Module *module)
+					{
+						return std::find_if(m_modules.begin(), m_modules.end(), [module](const std::pair<const float, std::unique_ptr<Module>> &pair)
+						{
+							return pair.second.get() == module;
+						}) == m_modules.end();
+					}), level.end());
+				}
+			}
+
+			if (level.empty())
+			{
+				continue;
+			}
+
+			// A module alone in its level is run on the calling thread, modules that have not declared access always end up alone.
+			if (level.size() == 1)
+			{
+				UpdateModule(level[0]);
+				continue;
+			}
+
+			Engine::Get()->GetJobSystem().ParallelFor(0, static_cast<uint32_t>(level.size()), [&level](uint32_t begin, uint32_t end)
+			{
+				for (uint32_t i = begin; i < end; i++)
+				{
+					UpdateModule(level[i]);
+				}
+			}, 1);
+		}
+	}
+
+	std::vector<std::vector<Module *>> ModuleManager::BuildStage(const ModuleUpdate &update) const
+	{
+		std::vector<Module *> modules = {};
+
+		for (auto &[key, module] : m_modules)
+		{
+			if (static_cast<int32_t>(std::floor(key)) == update)
+			{
+				modules.emplace_back(module.get());
+			}
+		}
+
+		auto count = static_cast<uint32_t>(modules.size());
+		std::vector<std::vector<uint32_t>> successors(count);
+		std::vector<uint32_t> predecessors(count);
+
+		// Conflicting modules keep the order they were registered in.
+		for (uint32_t i = 0; i < count; i++)
+		{
+			for (uint32_t j = i + 1; j < count; j++)
+			{
+				if (Conflicts(modules[i], modules[j]))
+				{
+					successors[i].emplace_back(j);
+					predecessors[j]++;
+				}
+			}
+		}
+
+		for (auto &[module, dependency] : m_dependencies)
+		{
+			auto first = std::find(modules.begin(), modules.end(), dependency);
+			auto second = std::find(modules.begin(), modules.end(), module);
+
+			if (first == modules.end() || second == modules.end())
+			{
+				continue;
+			}
+
+			auto i = static_cast<uint32_t>(first - modules.begin());
+			auto j = static_cast<uint32_t>(second - modules.begin());
+			successors[i].emplace_back(j);
+			predecessors[j]++;
+		}
+
+		// Places every module one level after its deepest predecessor.
+		std::vector<uint32_t> levels(count);
+		std::queue<uint32_t> ready = {};
+		uint32_t levelCount = 0;
+		uint32_t processed = 0;
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (predecessors[i] == 0)
+			{
+				ready.push(i);
+			}
+		}
+
+		while (!ready.empty())
+		{
+			uint32_t i = ready.front();
+			ready.pop();
+			processed++;
+			levelCount = std::max(levelCount, levels[i] + 1);
+
+			for (auto &j : successors[i])
+			{
+				levels[j] = std::max(levels[j], levels[i] + 1);
+
+				if (--predecessors[j] == 0)
+				{
+					ready.push(j);
+				}
+			}
+		}
+
+		std::vector<std::vector<Module *>> result = {};
+
+		if (processed != count)
+		{
+			Log::Error("Module dependencies for update '%i' contain a cycle, updating in registered order!\n", update);
+
+			for (auto &module : modules)
+			{
+				result.emplace_back(std::vector<Module *>{module});
+			}
+
+			return result;
+		}
+
+		result.resize(levelCount);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			result[levels[i]].emplace_back(modules[i]);
+		}
+
+		return result;
+	}
+
+	bool ModuleManager::Conflicts(const Module *a, const Module *b)
+	{
+		if (!a->IsAccessDeclared() || !b->IsAccessDeclared())
+		{
+			return true;
+		}
+
+		for (auto &write : a->m_writes)
+		{
+			if (std::find(b->m_writes.begin(), b->m_writes.end(), write) != b->m_writes.end() ||
+				std::find(b->m_reads.begin(), b->m_reads.end(), write) != b->m_reads.end())
+			{
+				return true;
+			}
+		}
+
+		for (auto &write : b->m_writes)
+		{
+			if (std::find(a->m_reads.begin(), a->m_reads.end(), write) != a->m_reads.end())
+			{
+				return true;
+			}
+		}
+
+		return false;
 	}
 }
@@ -3,6 +3,8 @@
 #include <map>
 #include <mutex>
 #include <memory>
+#include <typeindex>
+#include <vector>
 #include "Module.hpp"
 
 namespace acid
@@ -14,19 +16,26 @@ namespace acid
 	{
 	private:
 		friend class ModuleUpdater;
-		std::mutex m_mutex;
+		mutable std::mutex m_mutex;
 		std::map<float, std::unique_ptr<Module>> m_modules;
+		std::vector<Module *> m_typeModules;
+		std::vector<std::pair<Module *, Module *>> m_dependencies;
+		std::map<ModuleUpdate, std::vector<std::vector<Module *>>> m_stages;
+		bool m_stagesDirty;
 	public:
 		ModuleManager();
 
 		ModuleManager(const ModuleManager&) = delete;
 
+		~ModuleManager();
+
 		ModuleManager& operator=(const ModuleManager&) = delete;
 
 		/// <summary>
 		/// Fills the module register with default modules.
 		/// </summary>
-		void FillRegister();
+		/// <param name="headless"> If the display, renderer and modules that only feed the renderer are left out. </param>
+		void FillRegister(const bool &headless = false);
 
 		/// <summary>
 		/// Gets if a module is contained in this registry.
@@ -36,24 +45,21 @@ namespace acid
 		bool Contains(Module *module);
 
 		/// <summary>
-		/// Gets a module instance by type from the register.
+		/// Gets a module instance by type from the register, modules are found by the exact type they were registered as.
 		/// </summary>
 		/// <param name="T"> The module type to find. </param>
 		/// <returns> The found module. </returns>
 		template<typename T>
 		T *Get() const
 		{
-			for (auto &[key, module] : m_modules)
-			{
-				auto casted = dynamic_cast<T *>(module.get());
+			auto typeId = GetTypeId<T>();
 
-				if (casted != nullptr)
-				{
-					return casted;
-				}
+			if (typeId >= m_typeModules.size())
+			{
+				return nullptr;
 			}
 
-			return nullptr;
+			return static_cast<T *>(m_typeModules[typeId]);
 		}
 
 		/// <summary>
@@ -73,12 +79,31 @@ namespace acid
 		template<typename T>
 		T *Add(const ModuleUpdate &update)
 		{
+			// The module is registered before it is constructed so it can be found from inside its constructor.
 			auto module = static_cast<T *>(malloc(sizeof(T)));
-			Add(module, update);
+			Add(module, update, GetTypeId<T>());
 			new(module) T();
 			return module;
 		}
 
+		/// <summary>
+		/// Adds a explicit ordering edge between two modules in the same update type, the module will only update after the dependency has updated.
+		/// </summary>
+		/// <param name="module"> The module that updates second. </param>
+		/// <param name="dependency"> The module that updates first. </param>
+		void AddDependency(Module *module, Module *dependency);
+
+		/// <summary>
+		/// Adds a explicit ordering edge between two modules in the same update type, the module will only update after the dependency has updated.
+		/// </summary>
+		/// <param name="T"> The type of module that updates second. </param>
+		/// <param name="D"> The type of module that updates first. </param>
+		template<typename T, typename D>
+		void AddDependency()
+		{
+			AddDependency(Get<T>(), Get<D>());
+		}
+
 		/// <summary>
 		/// Deregisters a module.
 		/// </summary>
@@ -92,23 +117,62 @@ namespace acid
 		template<typename T>
 		void Remove()
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
+			Remove(Get<T>());
+		}
 
-			for (auto it = --m_modules.end(); it != m_modules.begin(); --it)
-			{
-				auto casted = dynamic_cast<T *>((*it).second.get());
+		/// <summary>
+		/// Gets a small unique id for a type, used to index modules by type.
+		/// </summary>
+		/// <param name="type"> The type. </param>
+		/// <returns> The type id. </returns>
+		static uint32_t GetTypeId(const std::type_index &type);
 
-				if (casted != nullptr)
-				{
-					m_modules.erase(it);
-				}
-			}
+		/// <summary>
+		/// Gets a small unique id for a type, used to index modules by type.
+		/// </summary>
+		/// <param name="T"> The type. </param>
+		/// <returns> The type id. </returns>
+		template<typename T>
+		static uint32_t GetTypeId()
+		{
+			static const uint32_t typeId = GetTypeId(typeid(T));
+			return typeId;
 		}
 	private:
+		Module *Add(Module *module, const ModuleUpdate &update, const uint32_t &typeId);
+
 		/// <summary>
-		/// Runs updates for all module update types.
+		/// Runs updates for all modules of a update type, modules with no dependency between them are updated in parallel.
 		/// </summary>
 		/// <param name="update"> The modules update type. </param>
 		void RunUpdate(const ModuleUpdate &update);
+
+		/// <summary>
+		/// Gets the amount of time until any module next needs to update.
+		/// </summary>
+		/// <returns> The closest time a module needs to update. </returns>
+		Time GetTimeUntilUpdate() const;
+
+		/// <summary>
+		/// Gets if any module is registered with a update type.
+		/// </summary>
+		/// <param name="update"> The modules update type. </param>
+		/// <returns> If a module updates with the update type. </returns>
+		bool HasModules(const ModuleUpdate &update) const;
+
+		/// <summary>
+		/// Sorts the modules of a update type into levels, every module in a level can update in parallel once the previous level has finished.
+		/// </summary>
+		/// <param name="update"> The modules update type. </param>
+		/// <returns> The levels of modules. </returns>
+		std::vector<std::vector<Module *>> BuildStage(const ModuleUpdate &update) const;
+
+		/// <summary>
+		/// Gets if two modules cannot update at the same time.
+		/// </summary>
+		/// <param name="a"> The first module. </param>
+		/// <param name="b"> The second module. </param>
+		/// <returns> If the modules access conflicts. </returns>
+		static bool Conflicts(const Module *a, const Module *b);
 	};
 }
@@ -1,20 +1,33 @@
 #include "ModuleUpdater.hpp"
 
+#include <algorithm>
+#include <thread>
 #include "Engine/Engine.hpp"
+#include "Engine/Profiler.hpp"
 #include "Maths/Maths.hpp"
+#include "Memory/FrameArena.hpp"
 
 namespace acid
 {
+	const Time ModuleUpdater::SLEEP_MARGIN = Time::Milliseconds(2);
+
 	ModuleUpdater::ModuleUpdater() :
 		m_deltaUpdate(Delta()),
 		m_deltaRender(Delta()),
 		m_timerUpdate(Timer(Time::Seconds(1.0f / 66.0f))),
-		m_timerRender(Timer(Time::Seconds(1.0f / -1.0f)))
+		m_timerRender(Timer(Time::Seconds(1.0f / -1.0f))),
+		m_timerStatistics(Timer(Time::Seconds(1.0f))),
+		m_timeBusy(Time::ZERO),
+		m_timeIdle(Time::ZERO),
+		m_lastBusy(Time::ZERO),
+		m_lastIdle(Time::ZERO)
 	{
 	}
 
 	void ModuleUpdater::Update(ModuleManager &moduleManager)
 	{
+		Time start = Engine::GetTime();
+
 		m_timerRender.SetInterval(Time::Seconds(1.0f / Engine::Get()->GetFpsLimit()));
 
 		// Always-Update.
@@ -55,6 +68,62 @@ namespace acid
 
 			// Updates the render delta, and render time extension.
 			m_deltaRender.Update();
+
+			// Frames end after a render, a pipelined render has been waited on before the next render so its memory is never reused under it.
+			FrameArena::EndFrame();
+		}
+
+		ACID_PROFILE_FRAME();
+
+		m_timeBusy += Engine::GetTime() - start;
+		Wait(moduleManager);
+
+		if (m_timerStatistics.IsPassedTime())
+		{
+			m_timerStatistics.ResetStartTime();
+			m_lastBusy = m_timeBusy;
+			m_lastIdle = m_timeIdle;
+			m_timeBusy = Time::ZERO;
+			m_timeIdle = Time::ZERO;
 		}
 	}
+
+	void ModuleUpdater::Wait(ModuleManager &moduleManager)
+	{
+		// A render is needed every loop when there is no fps limit, without a renderer only updates and module deadlines are waited on.
+		bool renders = moduleManager.HasModules(MODULE_UPDATE_RENDER);
+
+		if (renders && Engine::Get()->GetFpsLimit() <= 0.0f)
+		{
+			return;
+		}
+
+		Time wait = std::min(m_timerUpdate.GetRemaining(), moduleManager.GetTimeUntilUpdate());
+
+		if (renders)
+		{
+			wait = std::min(wait, m_timerRender.GetRemaining());
+		}
+
+		if (wait <= Time::ZERO)
+		{
+			return;
+		}
+
+		Time start = Engine::GetTime();
+		Time deadline = start + wait;
+
+		// Sleeps most of the way, OS sleeps can overshoot so the rest is spent yielding.
+		if (wait > SLEEP_MARGIN)
+		{
+			std::this_thread::sleep_for(std::chrono::microseconds((wait - SLEEP_MARGIN).AsMicroseconds()));
+		}
+
+		while (Engine::GetTime() < deadline)
+		{
+			std::this_thread::yield();
+		}
+
+		m_timeIdle += Engine::GetTime() - start;
+	}
 }
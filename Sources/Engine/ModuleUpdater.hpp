@@ -17,11 +17,22 @@ namespace acid
 		Delta m_deltaRender;
 		Timer m_timerUpdate;
 		Timer m_timerRender;
+		Timer m_timerStatistics;
+
+		Time m_timeBusy;
+		Time m_timeIdle;
+		Time m_lastBusy;
+		Time m_lastIdle;
 	public:
+		/// <summary>
+		/// How long before a deadline the updater stops sleeping and yields instead, covers the inaccuracy of OS sleeps.
+		/// </summary>
+		static const Time SLEEP_MARGIN;
+
 		ModuleUpdater();
 
 		/// <summary>
-		/// Updates all modules in order.
+		/// Updates all modules in order, then sleeps until the next update, render or module deadline.
 		/// </summary>
 		void Update(ModuleManager &moduleManager);
 
@@ -36,5 +47,19 @@ namespace acid
 		/// </summary>
 		/// <returns> The delta between renders. </returns>
 		Time GetDeltaRender() const { return m_deltaRender.GetChange(); }
+
+		/// <summary>
+		/// Gets the time spent updating modules over the last second.
+		/// </summary>
+		/// <returns> The busy time. </returns>
+		Time GetTimeBusy() const { return m_lastBusy; }
+
+		/// <summary>
+		/// Gets the time spent waiting for the next deadline over the last second.
+		/// </summary>
+		/// <returns> The idle time. </returns>
+		Time GetTimeIdle() const { return m_lastIdle; }
+	private:
+		void Wait(ModuleManager &moduleManager);
 	};
 }
\ No newline at end of file
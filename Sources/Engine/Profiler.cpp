@@ -0,0 +1,348 @@
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <unordered_map>
+#include "Helpers/FileSystem.hpp"
+#include "Log.hpp"
+#if !defined(ACID_BUILD_MSVC)
+#include <cxxabi.h>
+#endif
+
+namespace acid
+{
+	/// <summary>
+	/// A single producer single consumer ring of events, written by its thread and drained by <seealso cref="Profiler#EndFrame()"/>.
+	/// </summary>
+	class Profiler::Buffer
+	{
+	public:
+		std::vector<ProfilerEvent> m_events;
+		std::atomic<uint64_t> m_written;
+		std::atomic<uint64_t> m_read;
+		std::atomic<uint64_t> m_dropped;
+		uint32_t m_thread;
+		uint32_t m_depth;
+
+		explicit Buffer(const uint32_t &thread) :
+			m_events(std::vector<ProfilerEvent>(BUFFER_CAPACITY)),
+			m_written(0),
+			m_read(0),
+			m_dropped(0),
+			m_thread(thread),
+			m_depth(0)
+		{
+		}
+	};
+
+	using ProfilerClock = std::chrono::steady_clock;
+
+	static const ProfilerClock::time_point PROFILER_START = ProfilerClock::now();
+
+	/// <summary>
+	/// Writes a quoted JSON string, names can hold quotes and backslashes from template types.
+	/// </summary>
+	static void WriteString(std::ostream &stream, const char *string)
+	{
+		stream << '"';
+
+		for (auto c = string; *c != '\0'; c++)
+		{
+			switch (*c)
+			{
+			case '"':
+				stream << "\\\"";
+				break;
+			case '\\':
+				stream << "\\\\";
+				break;
+			case '\n':
+				stream << "\\n";
+				break;
+			case '\r':
+				stream << "\\r";
+				break;
+			case '\t':
+				stream << "\\t";
+				break;
+			default:
+				if (static_cast<unsigned char>(*c) < 0x20)
+				{
+					stream << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(*c) << std::dec << std::setfill(' ');
+				}
+				else
+				{
+					stream << *c;
+				}
+
+				break;
+			}
+		}
+
+		stream << '"';
+	}
+
+	const uint32_t Profiler::BUFFER_CAPACITY = 16384;
+	const uint32_t Profiler::CAPTURE_CAPACITY = 4000000;
+
+	std::atomic<bool> Profiler::ENABLED = true;
+	std::mutex Profiler::MUTEX = std::mutex();
+	std::vector<std::unique_ptr<Profiler::Buffer>> Profiler::BUFFERS = std::vector<std::unique_ptr<Profiler::Buffer>>();
+	std::vector<ProfilerSample> Profiler::FRAME = std::vector<ProfilerSample>();
+	std::vector<ProfilerCounter> Profiler::COUNTERS = std::vector<ProfilerCounter>();
+	std::vector<ProfilerCounter> Profiler::FRAME_COUNTERS = std::vector<ProfilerCounter>();
+	int64_t Profiler::FRAME_TIME = 0;
+	int64_t Profiler::FRAME_START = 0;
+	bool Profiler::CAPTURING = false;
+	std::vector<ProfilerEvent> Profiler::CAPTURE = std::vector<ProfilerEvent>();
+	std::vector<ProfilerCounter> Profiler::CAPTURE_COUNTERS = std::vector<ProfilerCounter>();
+	uint64_t Profiler::DROPPED = 0;
+
+	int64_t Profiler::GetTime()
+	{
+		return std::chrono::duration_cast<std::chrono::nanoseconds>(ProfilerClock::now() - PROFILER_START).count();
+	}
+
+	void Profiler::Record(const char *name, const int64_t &start, const int64_t &end, const uint32_t &depth)
+	{
+		auto buffer = GetBuffer();
+		uint64_t written = buffer->m_written.load(std::memory_order_relaxed);
+
+		if (written - buffer->m_read.load(std::memory_order_acquire) >= BUFFER_CAPACITY)
+		{
+			buffer->m_dropped.fetch_add(1, std::memory_order_relaxed);
+			return;
+		}
+
+		buffer->m_events[written % BUFFER_CAPACITY] = {name, start, end, depth, buffer->m_thread};
+		buffer->m_written.store(written + 1, std::memory_order_release);
+	}
+
+	uint32_t Profiler::PushDepth()
+	{
+		return GetBuffer()->m_depth++;
+	}
+
+	void Profiler::PopDepth()
+	{
+		GetBuffer()->m_depth--;
+	}
+
+	void Profiler::SetCounter(const char *name, const int64_t &value)
+	{
+		int64_t now = GetTime();
+
+		std::lock_guard<std::mutex> lock(MUTEX);
+		auto it = std::find_if(COUNTERS.begin(), COUNTERS.end(), [name](const ProfilerCounter &counter)
+		{
+			return counter.m_name == name;
+		});
+
+		if (it == COUNTERS.end())
+		{
+			COUNTERS.push_back({name, now, value});
+			return;
+		}
+
+		it->m_time = now;
+		it->m_value = value;
+	}
+
+	void Profiler::EndFrame()
+	{
+		int64_t now = GetTime();
+
+		std::lock_guard<std::mutex> lock(MUTEX);
+
+		FRAME_TIME = now - FRAME_START;
+		FRAME_START = now;
+		FRAME.clear();
+
+		std::map<std::pair<const char *, uint32_t>, size_t> indices;
+
+		for (auto &buffer : BUFFERS)
+		{
+			uint64_t read = buffer->m_read.load(std::memory_order_relaxed);
+			uint64_t written = buffer->m_written.load(std::memory_order_acquire);
+
+			for (; read < written; read++)
+			{
+				auto &event = buffer->m_events[read % BUFFER_CAPACITY];
+				auto duration = event.m_end - event.m_start;
+				auto [it, inserted] = indices.emplace(std::make_pair(event.m_name, event.m_depth), FRAME.size());
+
+				if (inserted)
+				{
+					FRAME.push_back({event.m_name, event.m_depth, 0, 0, 0});
+				}
+
+				auto &sample = FRAME[it->second];
+				sample.m_calls++;
+				sample.m_total += duration;
+				sample.m_max = std::max(sample.m_max, duration);
+
+				if (CAPTURING && CAPTURE.size() < CAPTURE_CAPACITY)
+				{
+					CAPTURE.emplace_back(event);
+				}
+			}
+
+			buffer->m_read.store(read, std::memory_order_release);
+			DROPPED += buffer->m_dropped.exchange(0, std::memory_order_relaxed);
+		}
+
+		if (CAPTURING)
+		{
+			CAPTURE_COUNTERS.insert(CAPTURE_COUNTERS.end(), COUNTERS.begin(), COUNTERS.end());
+		}
+
+		FRAME_COUNTERS.swap(COUNTERS);
+		COUNTERS.clear();
+
+		std::sort(FRAME.begin(), FRAME.end(), [](const ProfilerSample &a, const ProfilerSample &b)
+		{
+			if (a.m_depth != b.m_depth)
+			{
+				return a.m_depth < b.m_depth;
+			}
+
+			return a.m_total > b.m_total;
+		});
+	}
+
+	std::vector<ProfilerSample> Profiler::GetFrame()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return FRAME;
+	}
+
+	std::vector<ProfilerCounter> Profiler::GetCounters()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return FRAME_COUNTERS;
+	}
+
+	int64_t Profiler::GetFrameTime()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return FRAME_TIME;
+	}
+
+	uint64_t Profiler::GetDropped()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return DROPPED;
+	}
+
+	void Profiler::BeginCapture()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		CAPTURING = true;
+		CAPTURE.clear();
+		CAPTURE_COUNTERS.clear();
+	}
+
+	void Profiler::EndCapture(const std::string &filename)
+	{
+		std::vector<ProfilerEvent> capture;
+		std::vector<ProfilerCounter> counters;
+
+		{
+			std::lock_guard<std::mutex> lock(MUTEX);
+			CAPTURING = false;
+			capture.swap(CAPTURE);
+			counters.swap(CAPTURE_COUNTERS);
+		}
+
+		FileSystem::Create(filename);
+		std::ofstream stream(filename);
+
+		if (!stream.is_open())
+		{
+			Log::Error("Failed to write profiler capture '%s'\n", filename.c_str());
+			return;
+		}
+
+		// Chrome trace event format, complete and counter events with times in microseconds.
+		stream << std::fixed << std::setprecision(3);
+		stream << "{\"traceEvents\":[";
+
+		for (size_t i = 0; i < capture.size(); i++)
+		{
+			auto &event = capture[i];
+			stream << (i == 0 ? "\n" : ",\n");
+			stream << "{\"name\":";
+			WriteString(stream, event.m_name);
+			stream << ",\"ph\":\"X\",\"pid\":0,\"tid\":" << event.m_thread;
+			stream << ",\"ts\":" << static_cast<double>(event.m_start) / 1000.0;
+			stream << ",\"dur\":" << static_cast<double>(event.m_end - event.m_start) / 1000.0 << "}";
+		}
+
+		for (size_t i = 0; i < counters.size(); i++)
+		{
+			auto &counter = counters[i];
+			stream << (i == 0 && capture.empty() ? "\n" : ",\n");
+			stream << "{\"name\":";
+			WriteString(stream, counter.m_name);
+			stream << ",\"ph\":\"C\",\"pid\":0";
+			stream << ",\"ts\":" << static_cast<double>(counter.m_time) / 1000.0;
+			stream << ",\"args\":{\"value\":" << counter.m_value << "}}";
+		}
+
+		stream << "\n],\"displayTimeUnit\":\"ms\"}\n";
+	}
+
+	const char *Profiler::GetTypeName(const std::type_info &type)
+	{
+		static std::mutex mutex;
+		static std::unordered_map<const std::type_info *, std::string> names;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		auto it = names.find(&type);
+
+		if (it != names.end())
+		{
+			return it->second.c_str();
+		}
+
+		std::string name = type.name();
+#if defined(ACID_BUILD_MSVC)
+		for (const std::string prefix : {"class ", "struct "})
+		{
+			if (name.compare(0, prefix.size(), prefix) == 0)
+			{
+				name = name.substr(prefix.size());
+			}
+		}
+#else
+		int status = 0;
+		char *demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+
+		if (status == 0 && demangled != nullptr)
+		{
+			name = demangled;
+		}
+
+		free(demangled);
+#endif
+		return names.emplace(&type, name).first->second.c_str();
+	}
+
+	Profiler::Buffer *Profiler::GetBuffer()
+	{
+		static thread_local Buffer *buffer = nullptr;
+
+		if (buffer == nullptr)
+		{
+			// Buffers are kept until exit so events from finished threads can still be drained.
+			std::lock_guard<std::mutex> lock(MUTEX);
+			BUFFERS.emplace_back(std::make_unique<Buffer>(static_cast<uint32_t>(BUFFERS.size())));
+			buffer = BUFFERS.back().get();
+		}
+
+		return buffer;
+	}
+}
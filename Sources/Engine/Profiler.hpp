@@ -0,0 +1,229 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include "Exports.hpp"
+
+#if defined(ACID_PROFILER)
+#define ACID_PROFILE_CONCAT_IMPL(a, b) a##b
+#define ACID_PROFILE_CONCAT(a, b) ACID_PROFILE_CONCAT_IMPL(a, b)
+// The name is only evaluated while the profiler is enabled.
+#define ACID_PROFILE_SCOPE(name) acid::ProfilerScope ACID_PROFILE_CONCAT(profilerScope, __LINE__)(acid::Profiler::IsEnabled() ? (name) : nullptr)
+#define ACID_PROFILE_FUNCTION() ACID_PROFILE_SCOPE(__FUNCTION__)
+#define ACID_PROFILE_FRAME() acid::Profiler::EndFrame()
+#define ACID_PROFILE_COUNTER(name, value) acid::Profiler::SetCounter(name, value)
+#else
+#define ACID_PROFILE_SCOPE(name)
+#define ACID_PROFILE_FUNCTION()
+#define ACID_PROFILE_FRAME()
+#define ACID_PROFILE_COUNTER(name, value)
+#endif
+
+namespace acid
+{
+	/// <summary>
+	/// A timed scope recorded by the profiler, times are in nanoseconds since the profiler started.
+	/// </summary>
+	struct ProfilerEvent
+	{
+		const char *m_name;
+		int64_t m_start;
+		int64_t m_end;
+		uint32_t m_depth;
+		uint32_t m_thread;
+	};
+
+	/// <summary>
+	/// The time spent in a named scope over a frame.
+	/// </summary>
+	struct ProfilerSample
+	{
+		const char *m_name;
+		uint32_t m_depth;
+		uint32_t m_calls;
+		int64_t m_total;
+		int64_t m_max;
+	};
+
+	/// <summary>
+	/// A named value sampled once a frame, like an allocation count.
+	/// </summary>
+	struct ProfilerCounter
+	{
+		const char *m_name;
+		int64_t m_time;
+		int64_t m_value;
+	};
+
+	/// <summary>
+	/// A hierarchical CPU profiler. Every thread records scopes into its own ring buffer without locking,
+	/// the buffers are drained once a frame into per frame samples and optionally into a capture that can be saved as a Chrome trace.
+	/// Scopes are recorded with <seealso cref="ACID_PROFILE_SCOPE"/>, which compiles to nothing unless ACID_PROFILER is defined.
+	/// </summary>
+	class ACID_EXPORT Profiler
+	{
+	private:
+		class Buffer;
+
+		static std::atomic<bool> ENABLED;
+		static std::mutex MUTEX;
+		static std::vector<std::unique_ptr<Buffer>> BUFFERS;
+		static std::vector<ProfilerSample> FRAME;
+		static std::vector<ProfilerCounter> COUNTERS;
+		static std::vector<ProfilerCounter> FRAME_COUNTERS;
+		static int64_t FRAME_TIME;
+		static int64_t FRAME_START;
+		static bool CAPTURING;
+		static std::vector<ProfilerEvent> CAPTURE;
+		static std::vector<ProfilerCounter> CAPTURE_COUNTERS;
+		static uint64_t DROPPED;
+	public:
+		/// <summary>
+		/// The amount of events each thread can record between frames, further events are dropped.
+		/// </summary>
+		static const uint32_t BUFFER_CAPACITY;
+
+		/// <summary>
+		/// The most events a capture will hold.
+		/// </summary>
+		static const uint32_t CAPTURE_CAPACITY;
+
+		/// <summary>
+		/// Gets if scopes are being recorded.
+		/// </summary>
+		/// <returns> If the profiler is enabled. </returns>
+		static bool IsEnabled() { return ENABLED.load(std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Sets if scopes are being recorded.
+		/// </summary>
+		/// <param name="enabled"> If the profiler is enabled. </param>
+		static void SetEnabled(const bool &enabled) { ENABLED.store(enabled, std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Gets the current profiler time.
+		/// </summary>
+		/// <returns> The time in nanoseconds since the profiler started. </returns>
+		static int64_t GetTime();
+
+		/// <summary>
+		/// Records a finished scope for the calling thread.
+		/// </summary>
+		/// <param name="name"> The scope name, must stay valid until the profiler is done with it. </param>
+		/// <param name="start"> The time the scope started. </param>
+		/// <param name="end"> The time the scope ended. </param>
+		/// <param name="depth"> How many scopes this scope is nested in. </param>
+		static void Record(const char *name, const int64_t &start, const int64_t &end, const uint32_t &depth);
+
+		/// <summary>
+		/// Increases the scope depth of the calling thread.
+		/// </summary>
+		/// <returns> The depth before increasing. </returns>
+		static uint32_t PushDepth();
+
+		/// <summary>
+		/// Decreases the scope depth of the calling thread.
+		/// </summary>
+		static void PopDepth();
+
+		/// <summary>
+		/// Sets the value of a counter for this frame, use <seealso cref="ACID_PROFILE_COUNTER"/> instead of calling this directly.
+		/// </summary>
+		/// <param name="name"> The counter name, must stay valid until the profiler is done with it. </param>
+		/// <param name="value"> The counter value. </param>
+		static void SetCounter(const char *name, const int64_t &value);
+
+		/// <summary>
+		/// Drains every threads buffer into the frame samples and the capture, called once a frame by the engine.
+		/// </summary>
+		static void EndFrame();
+
+		/// <summary>
+		/// Gets the samples from the last frame, ordered by depth and then by time spent.
+		/// </summary>
+		/// <returns> The frame samples. </returns>
+		static std::vector<ProfilerSample> GetFrame();
+
+		/// <summary>
+		/// Gets the counters set during the last frame.
+		/// </summary>
+		/// <returns> The frame counters. </returns>
+		static std::vector<ProfilerCounter> GetCounters();
+
+		/// <summary>
+		/// Gets the length of the last frame.
+		/// </summary>
+		/// <returns> The frame time in nanoseconds. </returns>
+		static int64_t GetFrameTime();
+
+		/// <summary>
+		/// Gets the amount of events that were dropped because a buffer was full.
+		/// </summary>
+		/// <returns> The dropped event count. </returns>
+		static uint64_t GetDropped();
+
+		/// <summary>
+		/// Starts collecting every event into a capture.
+		/// </summary>
+		static void BeginCapture();
+
+		/// <summary>
+		/// Stops collecting events and writes the capture as a Chrome trace, it can be opened with chrome://tracing or Perfetto.
+		/// </summary>
+		/// <param name="filename"> The file to write into. </param>
+		static void EndCapture(const std::string &filename);
+
+		/// <summary>
+		/// Gets a readable name for a type that stays valid for the lifetime of the application.
+		/// </summary>
+		/// <param name="type"> The type to name. </param>
+		/// <returns> The type name. </returns>
+		static const char *GetTypeName(const std::type_info &type);
+	private:
+		static Buffer *GetBuffer();
+	};
+
+	/// <summary>
+	/// Records the time between its construction and destruction, use <seealso cref="ACID_PROFILE_SCOPE"/> instead of using this directly.
+	/// </summary>
+	class ACID_EXPORT ProfilerScope
+	{
+	private:
+		const char *m_name;
+		int64_t m_start;
+		uint32_t m_depth;
+	public:
+		/// <summary>
+		/// Creates a new profiler scope.
+		/// </summary>
+		/// <param name="name"> The scope name, nothing is recorded if null. </param>
+		explicit ProfilerScope(const char *name) :
+			m_name(name),
+			m_start(0),
+			m_depth(0)
+		{
+			if (m_name != nullptr)
+			{
+				m_depth = Profiler::PushDepth();
+				m_start = Profiler::GetTime();
+			}
+		}
+
+		ProfilerScope(const ProfilerScope&) = delete;
+
+		~ProfilerScope()
+		{
+			if (m_name != nullptr)
+			{
+				Profiler::Record(m_name, m_start, Profiler::GetTime(), m_depth);
+				Profiler::PopDepth();
+			}
+		}
+
+		ProfilerScope& operator=(const ProfilerScope&) = delete;
+	};
+}
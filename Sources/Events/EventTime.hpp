@@ -31,5 +31,7 @@ namespace acid
 		void OnEvent() override;
 
 		bool RemoveAfterEvent() override { return !m_repeat; }
+
+		Time GetTimeUntilTrigger() const override { return m_timer.GetRemaining(); }
 	};
 }
@@ -1,5 +1,7 @@
 #include "Events.hpp"
 
+#include <algorithm>
+
 namespace acid
 {
 	Events::Events() :
@@ -32,6 +34,20 @@ namespace acid
 		}
 	}
 
+	Time Events::GetTimeUntilUpdate()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		Time result = Time::POSITIVE_INFINITY;
+
+		for (auto &event : m_events)
+		{
+			result = std::min(result, event->GetTimeUntilTrigger());
+		}
+
+		return result;
+	}
+
 	IEvent *Events::AddEvent(IEvent *event)
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
@@ -31,6 +31,8 @@ namespace acid
 
 		void Update() override;
 
+		Time GetTimeUntilUpdate() override;
+
 		/// <summary>
 		/// Adds an event to the listening list.
 		/// </summary>
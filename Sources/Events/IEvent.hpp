@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Engine/Exports.hpp"
+#include "Maths/Time.hpp"
 
 namespace acid
 {
@@ -26,5 +27,11 @@ namespace acid
 		/// </summary>
 		/// <returns> If the even will run. </returns>
 		virtual bool RemoveAfterEvent() = 0;
+
+		/// <summary>
+		/// Gets the amount of time until the event can next trigger, events that are not timed return infinity.
+		/// </summary>
+		/// <returns> The time until the event can trigger. </returns>
+		virtual Time GetTimeUntilTrigger() const { return Time::POSITIVE_INFINITY; }
 	};
 }
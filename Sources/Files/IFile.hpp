@@ -13,6 +13,8 @@ namespace acid
 	class ACID_EXPORT IFile
 	{
 	public:
+		virtual ~IFile() = default;
+
 		virtual void Load() = 0;
 
 		virtual void Save() = 0;
@@ -2,6 +2,7 @@
 
 #include "Resources/Resources.hpp"
 #include "Helpers/String.hpp"
+#include "Memory/FrameArena.hpp"
 #include "Scenes/Scenes.hpp"
 #include "Gizmo.hpp"
 
@@ -43,7 +44,7 @@ namespace acid
 
 	void GizmoType::Update(const std::vector<std::unique_ptr<Gizmo>> &gizmos)
 	{
-		std::vector<GizmoTypeData> instanceDatas(MAX_TYPE_INSTANCES);
+		FrameVector<GizmoTypeData> instanceDatas(MAX_TYPE_INSTANCES);
 		m_instances = 0;
 
 		for (auto &gizmo : gizmos)
@@ -6,6 +6,7 @@ namespace acid
 		m_mutex(std::mutex()),
 		m_gizmos(std::map<std::shared_ptr<GizmoType>, std::vector<std::unique_ptr<Gizmo>>>())
 	{
+		Writes<Gizmos>();
 	}
 
 	void Gizmos::Update()
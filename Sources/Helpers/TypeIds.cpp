@@ -0,0 +1,17 @@
+#include "TypeIds.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace acid
+{
+	uint32_t TypeIds::Get(const std::type_index &family, const std::type_index &type)
+	{
+		static std::mutex mutex;
+		static std::unordered_map<std::type_index, std::unordered_map<std::type_index, uint32_t>> typeIds;
+
+		std::lock_guard<std::mutex> lock(mutex);
+		auto &familyIds = typeIds[family];
+		return familyIds.emplace(type, static_cast<uint32_t>(familyIds.size())).first->second;
+	}
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+#include <typeindex>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A helper that gives types small unique ids, ids are counted separately for every family so they stay dense enough to index arrays.
+	/// </summary>
+	class ACID_EXPORT TypeIds
+	{
+	public:
+		/// <summary>
+		/// Gets the id of a type within a family, the first type asked for in a family gets id 0.
+		/// </summary>
+		/// <param name="family"> The family the id is counted in, usually the base type. </param>
+		/// <param name="type"> The type. </param>
+		/// <returns> The type id. </returns>
+		static uint32_t Get(const std::type_index &family, const std::type_index &type);
+	};
+}
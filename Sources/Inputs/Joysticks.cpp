@@ -17,6 +17,12 @@ namespace acid
 
 	void Joysticks::Update()
 	{
+		// A headless engine never initializes GLFW, so no joysticks are ever connected.
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		for (auto &joystick : m_connected)
 		{
 			if (glfwJoystickPresent(joystick.m_port))
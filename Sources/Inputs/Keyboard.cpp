@@ -29,6 +29,12 @@ namespace acid
 			m_keyboardKeys[i] = false;
 		}
 
+		// A headless engine has no window, the keys stay released.
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		// Sets the keyboards callbacks.
 		glfwSetKeyCallback(Display::Get()->GetWindow(), CallbackKey);
 		glfwSetCharCallback(Display::Get()->GetWindow(), CallbackChar);
@@ -48,6 +48,12 @@ namespace acid
 			m_mouseButtons[i] = false;
 		}
 
+		// A headless engine has no window, the buttons stay released and the cursor only moves when set.
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		// Sets the mouses callbacks.
 		glfwSetScrollCallback(Display::Get()->GetWindow(), CallbackScroll);
 		glfwSetMouseButtonCallback(Display::Get()->GetWindow(), CallbackMouseButton);
@@ -88,6 +94,11 @@ namespace acid
 	{
 		m_mousePath = filename;
 
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		uint32_t width = 0;
 		uint32_t height = 0;
 		uint32_t components = 0;
@@ -110,7 +121,7 @@ namespace acid
 
 	void Mouse::SetCursorHidden(const bool &disabled)
 	{
-		if (m_cursorDisabled != disabled)
+		if (m_cursorDisabled != disabled && !Engine::Get()->IsHeadless())
 		{
 			glfwSetInputMode(Display::Get()->GetWindow(), GLFW_CURSOR, (disabled ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL));
 
@@ -137,6 +148,12 @@ namespace acid
 	{
 		m_mousePositionX = cursorX;
 		m_mousePositionY = cursorY;
+
+		if (Engine::Get()->IsHeadless())
+		{
+			return;
+		}
+
 		glfwSetCursorPos(Display::Get()->GetWindow(), cursorX * Display::Get()->GetWidth(), cursorY * Display::Get()->GetHeight());
 	}
 
@@ -8,8 +8,7 @@ namespace acid
 		m_colour(colour),
 		m_radius(radius),
 		m_position(Vector3()),
-		m_localTransform(localTransform),
-		m_worldTransform(Transform())
+		m_localTransform(localTransform)
 	{
 	}
 
@@ -17,8 +16,7 @@ namespace acid
 		m_colour(source.m_colour),
 		m_radius(source.m_radius),
 		m_position(Vector3()),
-		m_localTransform(source.m_localTransform),
-		m_worldTransform(source.m_worldTransform)
+		m_localTransform(source.m_localTransform)
 	{
 	}
 
@@ -26,10 +24,6 @@ namespace acid
 	{
 	}
 
-	void Light::Update()
-	{
-	}
-
 	void Light::Decode(const Metadata &metadata)
 	{
 		m_colour = metadata.GetChild<Colour>("Colour");
@@ -46,12 +40,6 @@ namespace acid
 
 	Transform Light::GetWorldTransform() const
 	{
-		if (m_localTransform.IsDirty() || GetParent()->GetWorldTransform().IsDirty())
-		{
-			m_worldTransform = GetParent()->GetWorldTransform() * m_localTransform;
-			m_localTransform.SetDirty(false);
-		}
-
-		return m_worldTransform;
+		return GetParent()->GetWorldTransform() * m_localTransform;
 	}
 }
@@ -18,7 +18,6 @@ namespace acid
 		Vector3 m_position;
 		float m_radius;
 		Transform m_localTransform;
-		mutable Transform m_worldTransform;
 	public:
 		/// <summary>
 		/// Creates a new point light.
@@ -36,8 +35,6 @@ namespace acid
 
 		void Start() override;
 
-		void Update() override;
-
 		void Decode(const Metadata &metadata) override;
 
 		void Encode(Metadata &metadata) const override;
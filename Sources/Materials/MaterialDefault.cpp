@@ -38,10 +38,6 @@ namespace acid
 			PIPELINE_MODE_MRT, PIPELINE_DEPTH_READ_WRITE, VK_POLYGON_MODE_FILL, VK_CULL_MODE_BACK_BIT, false, GetDefines()));
 	}
 
-	void MaterialDefault::Update()
-	{
-	}
-
 	void MaterialDefault::Decode(const Metadata &metadata)
 	{
 		m_baseDiffuse = metadata.GetChild<Colour>("Base Diffuse");
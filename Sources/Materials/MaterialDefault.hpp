@@ -35,8 +35,6 @@ namespace acid
 
 		void Start() override;
 
-		void Update() override;
-
 		void Decode(const Metadata &metadata) override;
 
 		void Encode(Metadata &metadata) const override;
@@ -0,0 +1,331 @@
+#include "Batch.hpp"
+
+#include <algorithm>
+#include "Physics/Aabb.hpp"
+#include "Matrix4.hpp"
+#include "Quaternion.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+#include "Vector4.hpp"
+
+namespace acid
+{
+	static void LoadRows(const Matrix4 &matrix, Simd::Float4 rows[4])
+	{
+		for (uint32_t row = 0; row < 4; row++)
+		{
+			rows[row] = Simd::Load(matrix.m_rows[row].m_elements);
+		}
+	}
+
+	/// <summary>
+	/// Transforms a vector with a w of one or zero, the last row is added instead of multiplied by one and left out for zero.
+	/// </summary>
+	template<bool Point>
+	static Simd::Float4 TransformVector(const Simd::Float4 rows[4], const Vector3 &vector)
+	{
+		auto result = Simd::Multiply(Simd::Splat(vector.m_x), rows[0]);
+		result = Simd::Add(result, Simd::Multiply(Simd::Splat(vector.m_y), rows[1]));
+		result = Simd::Add(result, Simd::Multiply(Simd::Splat(vector.m_z), rows[2]));
+		return Point ? Simd::Add(result, rows[3]) : result;
+	}
+
+	template<bool Point>
+	static void TransformVectors(const Matrix4 &matrix, const Vector3 *vectors, Vector3 *results, const std::size_t &count)
+	{
+		Simd::Float4 rows[4];
+		LoadRows(matrix, rows);
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			float lanes[4];
+			Simd::Store(lanes, TransformVector<Point>(rows, vectors[i]));
+			results[i] = Vector3(lanes[0], lanes[1], lanes[2]);
+		}
+	}
+
+	/// <summary>
+	/// Transforms four vectors, each lane of the result holds one element of one vector.
+	/// </summary>
+	template<bool Point>
+	static void TransformLanes(const Simd::Float4 columns[4][3], const Simd::Float4 &x, const Simd::Float4 &y, const Simd::Float4 &z, Simd::Float4 result[3])
+	{
+		for (uint32_t j = 0; j < 3; j++)
+		{
+			result[j] = Simd::Add(Simd::Add(Simd::Multiply(x, columns[0][j]), Simd::Multiply(y, columns[1][j])), Simd::Multiply(z, columns[2][j]));
+
+			if (Point)
+			{
+				result[j] = Simd::Add(result[j], columns[3][j]);
+			}
+		}
+	}
+
+	template<bool Point>
+	static void TransformVectors(const Matrix4 &matrix, const Vector3Soa &vectors, const Vector3Soa &results, const std::size_t &count)
+	{
+		Simd::Float4 columns[4][3];
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				columns[i][j] = Simd::Splat(matrix.m_rows[i].m_elements[j]);
+			}
+		}
+
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			Simd::Float4 result[3];
+			TransformLanes<Point>(columns, Simd::Load(vectors.m_x + i), Simd::Load(vectors.m_y + i), Simd::Load(vectors.m_z + i), result);
+			Simd::Store(results.m_x + i, result[0]);
+			Simd::Store(results.m_y + i, result[1]);
+			Simd::Store(results.m_z + i, result[2]);
+		}
+
+		// The remaining vectors are transformed one at a time, adding in the same order as the lanes.
+		for (; i < count; i++)
+		{
+			Vector3 result = Vector3();
+
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				result[j] = vectors.m_x[i] * matrix.m_rows[0][j] + vectors.m_y[i] * matrix.m_rows[1][j] + vectors.m_z[i] * matrix.m_rows[2][j];
+
+				if (Point)
+				{
+					result[j] += matrix.m_rows[3][j];
+				}
+			}
+
+			results.m_x[i] = result.m_x;
+			results.m_y[i] = result.m_y;
+			results.m_z[i] = result.m_z;
+		}
+	}
+
+	void Batch::TransformPoints(const Matrix4 &matrix, const Vector3 *points, Vector3 *results, const std::size_t &count)
+	{
+		TransformVectors<true>(matrix, points, results, count);
+	}
+
+	void Batch::TransformPoints(const Matrix4 &matrix, const Vector3Soa &points, const Vector3Soa &results, const std::size_t &count)
+	{
+		TransformVectors<true>(matrix, points, results, count);
+	}
+
+	void Batch::TransformDirections(const Matrix4 &matrix, const Vector3 *directions, Vector3 *results, const std::size_t &count)
+	{
+		TransformVectors<false>(matrix, directions, results, count);
+	}
+
+	void Batch::TransformDirections(const Matrix4 &matrix, const Vector3Soa &directions, const Vector3Soa &results, const std::size_t &count)
+	{
+		TransformVectors<false>(matrix, directions, results, count);
+	}
+
+	void Batch::Transform(const Matrix4 &matrix, const Vector4 *vectors, Vector4 *results, const std::size_t &count)
+	{
+		Simd::Float4 rows[4];
+		LoadRows(matrix, rows);
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			Simd::Store(results[i].m_elements, Simd::CombineRows(rows, Simd::Load(vectors[i].m_elements)));
+		}
+	}
+
+	void Batch::Multiply(const Matrix4 *left, const Matrix4 *right, Matrix4 *results, const std::size_t &count)
+	{
+		for (std::size_t i = 0; i < count; i++)
+		{
+			Simd::Float4 rows[4];
+			LoadRows(left[i], rows);
+
+			// A row is only written after the same row of the right matrix is read, so either input can be the results.
+			for (uint32_t row = 0; row < 4; row++)
+			{
+				Simd::Store(results[i].m_rows[row].m_elements, Simd::CombineRows(rows, Simd::Load(right[i].m_rows[row].m_elements)));
+			}
+		}
+	}
+
+	void Batch::Multiply(const Matrix4 &left, const Matrix4 *right, Matrix4 *results, const std::size_t &count)
+	{
+		Simd::Float4 rows[4];
+		LoadRows(left, rows);
+
+		for (std::size_t i = 0; i < count; i++)
+		{
+			for (uint32_t row = 0; row < 4; row++)
+			{
+				Simd::Store(results[i].m_rows[row].m_elements, Simd::CombineRows(rows, Simd::Load(right[i].m_rows[row].m_elements)));
+			}
+		}
+	}
+
+	void Batch::TransformationMatrices(const Vector3 *translations, const Quaternion *rotations, const Vector3 *scales, Matrix4 *results, const std::size_t &count)
+	{
+		auto zero = Simd::Splat(0.0f);
+		auto one = Simd::Splat(1.0f);
+		auto two = Simd::Splat(2.0f);
+		std::size_t i = 0;
+
+		// Four rotations are turned so each lane holds one of them, every matrix element is then found for all four at once.
+		for (; i + 4 <= count; i += 4)
+		{
+			auto x = Simd::Load(rotations[i].m_elements);
+			auto y = Simd::Load(rotations[i + 1].m_elements);
+			auto z = Simd::Load(rotations[i + 2].m_elements);
+			auto w = Simd::Load(rotations[i + 3].m_elements);
+			Simd::Transpose(x, y, z, w);
+
+			auto xy = Simd::Multiply(x, y);
+			auto xz = Simd::Multiply(x, z);
+			auto xw = Simd::Multiply(x, w);
+			auto yz = Simd::Multiply(y, z);
+			auto yw = Simd::Multiply(y, w);
+			auto zw = Simd::Multiply(z, w);
+			auto xSquared = Simd::Multiply(x, x);
+			auto ySquared = Simd::Multiply(y, y);
+			auto zSquared = Simd::Multiply(z, z);
+
+			auto scaleX = Simd::Set(scales[i].m_x, scales[i + 1].m_x, scales[i + 2].m_x, scales[i + 3].m_x);
+			auto scaleY = Simd::Set(scales[i].m_y, scales[i + 1].m_y, scales[i + 2].m_y, scales[i + 3].m_y);
+			auto scaleZ = Simd::Set(scales[i].m_z, scales[i + 1].m_z, scales[i + 2].m_z, scales[i + 3].m_z);
+
+			Simd::Float4 rows[3][4] = {
+				{
+					Simd::Subtract(one, Simd::Multiply(two, Simd::Add(ySquared, zSquared))), Simd::Multiply(two, Simd::Add(xy, zw)),
+					Simd::Multiply(two, Simd::Subtract(xz, yw)), zero
+				},
+				{
+					Simd::Multiply(two, Simd::Subtract(xy, zw)), Simd::Subtract(one, Simd::Multiply(two, Simd::Add(xSquared, zSquared))),
+					Simd::Multiply(two, Simd::Add(yz, xw)), zero
+				},
+				{
+					Simd::Multiply(two, Simd::Add(xz, yw)), Simd::Multiply(two, Simd::Subtract(yz, xw)),
+					Simd::Subtract(one, Simd::Multiply(two, Simd::Add(xSquared, ySquared))), zero
+				}
+			};
+			Simd::Float4 rowScales[3] = {scaleX, scaleY, scaleZ};
+
+			for (uint32_t row = 0; row < 3; row++)
+			{
+				for (uint32_t col = 0; col < 4; col++)
+				{
+					rows[row][col] = Simd::Multiply(rows[row][col], rowScales[row]);
+				}
+
+				// Turned back so each value is the row of one matrix.
+				Simd::Transpose(rows[row][0], rows[row][1], rows[row][2], rows[row][3]);
+
+				for (uint32_t k = 0; k < 4; k++)
+				{
+					Simd::Store(results[i + k].m_rows[row].m_elements, rows[row][k]);
+				}
+			}
+
+			for (uint32_t k = 0; k < 4; k++)
+			{
+				results[i + k].m_rows[3] = Vector4(translations[i + k], 1.0f);
+			}
+		}
+
+		for (; i < count; i++)
+		{
+			results[i] = Matrix4::TransformationMatrix(translations[i], rotations[i], scales[i]);
+		}
+	}
+
+	Aabb Batch::TransformedBounds(const Matrix4 &matrix, const Vector3 *points, const std::size_t &count)
+	{
+		if (count == 0)
+		{
+			return Aabb();
+		}
+
+		Simd::Float4 rows[4];
+		LoadRows(matrix, rows);
+		auto minimum = TransformVector<true>(rows, points[0]);
+		auto maximum = minimum;
+
+		for (std::size_t i = 1; i < count; i++)
+		{
+			auto point = TransformVector<true>(rows, points[i]);
+			minimum = Simd::Min(minimum, point);
+			maximum = Simd::Max(maximum, point);
+		}
+
+		float min[4];
+		float max[4];
+		Simd::Store(min, minimum);
+		Simd::Store(max, maximum);
+		return Aabb(Vector3(min[0], min[1], min[2]), Vector3(max[0], max[1], max[2]));
+	}
+
+	Aabb Batch::TransformedBounds(const Matrix4 &matrix, const Vector3Soa &points, const std::size_t &count)
+	{
+		Simd::Float4 rows[4];
+		LoadRows(matrix, rows);
+		Simd::Float4 columns[4][3];
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				columns[i][j] = Simd::Splat(matrix.m_rows[i].m_elements[j]);
+			}
+		}
+
+		Aabb result = Aabb();
+		std::size_t i = 0;
+
+		if (count >= 4)
+		{
+			Simd::Float4 minimum[3];
+			Simd::Float4 maximum[3];
+			TransformLanes<true>(columns, Simd::Load(points.m_x), Simd::Load(points.m_y), Simd::Load(points.m_z), minimum);
+			std::copy(minimum, minimum + 3, maximum);
+
+			for (i = 4; i + 4 <= count; i += 4)
+			{
+				Simd::Float4 transformed[3];
+				TransformLanes<true>(columns, Simd::Load(points.m_x + i), Simd::Load(points.m_y + i), Simd::Load(points.m_z + i), transformed);
+
+				for (uint32_t j = 0; j < 3; j++)
+				{
+					minimum[j] = Simd::Min(minimum[j], transformed[j]);
+					maximum[j] = Simd::Max(maximum[j], transformed[j]);
+				}
+			}
+
+			// Each lane kept the bounds of every fourth point, the lanes are combined last.
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				float min[4];
+				float max[4];
+				Simd::Store(min, minimum[j]);
+				Simd::Store(max, maximum[j]);
+				result.m_min[j] = std::min({min[0], min[1], min[2], min[3]});
+				result.m_max[j] = std::max({max[0], max[1], max[2], max[3]});
+			}
+		}
+
+		for (; i < count; i++)
+		{
+			float lanes[4];
+			Simd::Store(lanes, TransformVector<true>(rows, Vector3(points.m_x[i], points.m_y[i], points.m_z[i])));
+
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				result.m_min[j] = std::min(result.m_min[j], lanes[j]);
+				result.m_max[j] = std::max(result.m_max[j], lanes[j]);
+			}
+		}
+
+		return result;
+	}
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <cstddef>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	class Aabb;
+	class Matrix4;
+	class Quaternion;
+	class Vector3;
+	class Vector4;
+
+	/// <summary>
+	/// Three separate arrays viewed as the x, y and z of a list of vectors, four elements of each are transformed at once.
+	/// </summary>
+	struct ACID_EXPORT Vector3Soa
+	{
+		float *m_x;
+		float *m_y;
+		float *m_z;
+	};
+
+	/// <summary>
+	/// A class that transforms arrays of points, directions and matrices at once.
+	/// Each element gets the same bits as the matching single element operation, results may be written over their inputs.
+	/// </summary>
+	class ACID_EXPORT Batch
+	{
+	public:
+		/// <summary>
+		/// Transforms points by a matrix, as <seealso cref="Matrix4#Transform"/> with a w of one.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="points"> The points to transform. </param>
+		/// <param name="results"> The transformed points. </param>
+		/// <param name="count"> The amount of points. </param>
+		static void TransformPoints(const Matrix4 &matrix, const Vector3 *points, Vector3 *results, const std::size_t &count);
+
+		/// <summary>
+		/// Transforms points by a matrix, as <seealso cref="Matrix4#Transform"/> with a w of one.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="points"> The points to transform. </param>
+		/// <param name="results"> The transformed points. </param>
+		/// <param name="count"> The amount of points. </param>
+		static void TransformPoints(const Matrix4 &matrix, const Vector3Soa &points, const Vector3Soa &results, const std::size_t &count);
+
+		/// <summary>
+		/// Transforms directions by a matrix, they are rotated and scaled but not translated.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="directions"> The directions to transform. </param>
+		/// <param name="results"> The transformed directions. </param>
+		/// <param name="count"> The amount of directions. </param>
+		static void TransformDirections(const Matrix4 &matrix, const Vector3 *directions, Vector3 *results, const std::size_t &count);
+
+		/// <summary>
+		/// Transforms directions by a matrix, they are rotated and scaled but not translated.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="directions"> The directions to transform. </param>
+		/// <param name="results"> The transformed directions. </param>
+		/// <param name="count"> The amount of directions. </param>
+		static void TransformDirections(const Matrix4 &matrix, const Vector3Soa &directions, const Vector3Soa &results, const std::size_t &count);
+
+		/// <summary>
+		/// Transforms vectors by a matrix, as <seealso cref="Matrix4#Transform"/>.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="vectors"> The vectors to transform. </param>
+		/// <param name="results"> The transformed vectors. </param>
+		/// <param name="count"> The amount of vectors. </param>
+		static void Transform(const Matrix4 &matrix, const Vector4 *vectors, Vector4 *results, const std::size_t &count);
+
+		/// <summary>
+		/// Multiplies pairs of matrices, each result is left[i] * right[i].
+		/// </summary>
+		/// <param name="left"> The left matrices. </param>
+		/// <param name="right"> The right matrices. </param>
+		/// <param name="results"> The products. </param>
+		/// <param name="count"> The amount of pairs. </param>
+		static void Multiply(const Matrix4 *left, const Matrix4 *right, Matrix4 *results, const std::size_t &count);
+
+		/// <summary>
+		/// Multiplies one matrix by many, each result is left * right[i].
+		/// </summary>
+		/// <param name="left"> The left matrix. </param>
+		/// <param name="right"> The right matrices. </param>
+		/// <param name="results"> The products. </param>
+		/// <param name="count"> The amount of right matrices. </param>
+		static void Multiply(const Matrix4 &left, const Matrix4 *right, Matrix4 *results, const std::size_t &count);
+
+		/// <summary>
+		/// Creates transformation matrices from translations, rotations and scales, as <seealso cref="Matrix4#TransformationMatrix"/>.
+		/// </summary>
+		/// <param name="translations"> The translations. </param>
+		/// <param name="rotations"> The rotations. </param>
+		/// <param name="scales"> The scales. </param>
+		/// <param name="results"> The transformation matrices. </param>
+		/// <param name="count"> The amount of matrices. </param>
+		static void TransformationMatrices(const Vector3 *translations, const Quaternion *rotations, const Vector3 *scales, Matrix4 *results, const std::size_t &count);
+
+		/// <summary>
+		/// Gets the bounding box of points after they are transformed.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="points"> The points. </param>
+		/// <param name="count"> The amount of points. </param>
+		/// <returns> The box containing every transformed point, empty if there are no points. </returns>
+		static Aabb TransformedBounds(const Matrix4 &matrix, const Vector3 *points, const std::size_t &count);
+
+		/// <summary>
+		/// Gets the bounding box of points after they are transformed.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <param name="points"> The points. </param>
+		/// <param name="count"> The amount of points. </param>
+		/// <returns> The box containing every transformed point, empty if there are no points. </returns>
+		static Aabb TransformedBounds(const Matrix4 &matrix, const Vector3Soa &points, const std::size_t &count);
+	};
+}
@@ -1,22 +1,17 @@
 #include "Maths.hpp"
 
-#include <random>
+#include "RandomStream.hpp"
 
 namespace acid
 {
-	static std::random_device RANDOM_DEVICE;
-	static std::mt19937 RANDOM_GENERATOR(RANDOM_DEVICE());
-
 	float Maths::Random(const float &min, const float &max)
 	{
-		std::uniform_real_distribution<float> dist(min, max);
-		return dist(RANDOM_GENERATOR);
+		return RandomStream::Get().Next(min, max);
 	}
 
 	float Maths::RandomNormal(const float &standardDeviation, const float &mean)
 	{
-		std::normal_distribution<float> dist(mean, standardDeviation);
-		return dist(RANDOM_GENERATOR);
+		return RandomStream::Get().NextNormal(standardDeviation, mean);
 	}
 
 	float Maths::RandomLog(const float &min, const float &max)
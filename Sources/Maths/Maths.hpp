@@ -19,7 +19,7 @@ namespace acid
 	{
 	public:
 		/// <summary>
-		/// Generates a random value from between a range.
+		/// Generates a random value from between a range, using the <seealso cref="RandomStream"/> of the calling thread.
 		/// </summary>
 		/// <param name="min"> The min value. </param>
 		/// <param name="max"> The max value. </param>
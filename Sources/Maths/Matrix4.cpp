@@ -8,6 +8,7 @@
 #include "Quaternion.hpp"
 #include "Vector2.hpp"
 #include "Maths.hpp"
+#include "Simd.hpp"
 
 namespace acid
 {
@@ -53,16 +54,73 @@ namespace acid
 		memcpy(m_rows, source, 4 * sizeof(Vector4));
 	}
 
+	static void LoadRows(const Matrix4 &matrix, Simd::Float4 rows[4])
+	{
+		for (uint32_t row = 0; row < 4; row++)
+		{
+			rows[row] = Simd::Load(matrix.m_rows[row].m_elements);
+		}
+	}
+
+	/// <summary>
+	/// Finds the rows of the adjugate of a matrix from the 2x2 minors of its top and bottom two rows, the inverse is the adjugate divided by the determinant.
+	/// </summary>
+	static void Adjugate(const Matrix4 &matrix, Simd::Float4 adjugate[4])
+	{
+		Simd::Float4 rows[4];
+		LoadRows(matrix, rows);
+
+		// Minors over the column pairs 01, 02, 03, 12 in the first value, and 13, 23 in the first two lanes of the second.
+		auto top = Simd::Subtract(Simd::Multiply(Simd::Shuffle<0, 0, 0, 1>(rows[0]), Simd::Shuffle<1, 2, 3, 2>(rows[1])),
+			Simd::Multiply(Simd::Shuffle<0, 0, 0, 1>(rows[1]), Simd::Shuffle<1, 2, 3, 2>(rows[0])));
+		auto topRest = Simd::Subtract(Simd::Multiply(Simd::Shuffle<1, 2, 1, 2>(rows[0]), Simd::Splat<3>(rows[1])),
+			Simd::Multiply(Simd::Shuffle<1, 2, 1, 2>(rows[1]), Simd::Splat<3>(rows[0])));
+		auto bottom = Simd::Subtract(Simd::Multiply(Simd::Shuffle<0, 0, 0, 1>(rows[2]), Simd::Shuffle<1, 2, 3, 2>(rows[3])),
+			Simd::Multiply(Simd::Shuffle<0, 0, 0, 1>(rows[3]), Simd::Shuffle<1, 2, 3, 2>(rows[2])));
+		auto bottomRest = Simd::Subtract(Simd::Multiply(Simd::Shuffle<1, 2, 1, 2>(rows[2]), Simd::Splat<3>(rows[3])),
+			Simd::Multiply(Simd::Shuffle<1, 2, 1, 2>(rows[3]), Simd::Splat<3>(rows[2])));
+
+		// Each adjugate row pairs a bottom minor with the first two columns and a top minor with the last two.
+		auto minor01 = Simd::Shuffle<0, 0, 0, 0>(bottom, top);
+		auto minor02 = Simd::Shuffle<1, 1, 1, 1>(bottom, top);
+		auto minor03 = Simd::Shuffle<2, 2, 2, 2>(bottom, top);
+		auto minor12 = Simd::Shuffle<3, 3, 3, 3>(bottom, top);
+		auto minor13 = Simd::Shuffle<0, 0, 0, 0>(bottomRest, topRest);
+		auto minor23 = Simd::Shuffle<1, 1, 1, 1>(bottomRest, topRest);
+
+		// The columns of the matrix, with the elements of each two rows swapped.
+		Simd::Transpose(rows[0], rows[1], rows[2], rows[3]);
+		auto col0 = Simd::Shuffle<1, 0, 3, 2>(rows[0]);
+		auto col1 = Simd::Shuffle<1, 0, 3, 2>(rows[1]);
+		auto col2 = Simd::Shuffle<1, 0, 3, 2>(rows[2]);
+		auto col3 = Simd::Shuffle<1, 0, 3, 2>(rows[3]);
+
+		adjugate[0] = Simd::FlipSigns<false, true, false, true>(Simd::Add(Simd::Subtract(Simd::Multiply(col1, minor23), Simd::Multiply(col2, minor13)),
+			Simd::Multiply(col3, minor12)));
+		adjugate[1] = Simd::FlipSigns<true, false, true, false>(Simd::Add(Simd::Subtract(Simd::Multiply(col0, minor23), Simd::Multiply(col2, minor03)),
+			Simd::Multiply(col3, minor02)));
+		adjugate[2] = Simd::FlipSigns<false, true, false, true>(Simd::Add(Simd::Subtract(Simd::Multiply(col0, minor13), Simd::Multiply(col1, minor03)),
+			Simd::Multiply(col3, minor01)));
+		adjugate[3] = Simd::FlipSigns<true, false, true, false>(Simd::Add(Simd::Subtract(Simd::Multiply(col0, minor12), Simd::Multiply(col1, minor02)),
+			Simd::Multiply(col2, minor01)));
+	}
+
+	/// <summary>
+	/// Takes the determinant from the first row of a matrix and the first column of its adjugate.
+	/// </summary>
+	static float AdjugateDeterminant(const Matrix4 &matrix, const Simd::Float4 adjugate[4])
+	{
+		auto column = Simd::Shuffle<0, 2, 0, 2>(Simd::Shuffle<0, 0, 0, 0>(adjugate[0], adjugate[1]), Simd::Shuffle<0, 0, 0, 0>(adjugate[2], adjugate[3]));
+		return Simd::Sum(Simd::Multiply(Simd::Load(matrix.m_rows[0].m_elements), column));
+	}
+
 	Matrix4 Matrix4::Add(const Matrix4 &other) const
 	{
 		Matrix4 result = Matrix4();
 
 		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[row][col] + other[row][col];
-			}
+			Simd::Store(result[row].m_elements, Simd::Add(Simd::Load(m_rows[row].m_elements), Simd::Load(other[row].m_elements)));
 		}
 
 		return result;
@@ -74,10 +132,7 @@ namespace acid
 
 		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[row][col] - other[row][col];
-			}
+			Simd::Store(result[row].m_elements, Simd::Subtract(Simd::Load(m_rows[row].m_elements), Simd::Load(other[row].m_elements)));
 		}
 
 		return result;
@@ -86,13 +141,13 @@ namespace acid
 	Matrix4 Matrix4::Multiply(const Matrix4 &other) const
 	{
 		Matrix4 result = Matrix4();
+		Simd::Float4 rows[4];
+		LoadRows(*this, rows);
 
+		// Each row of the result is the rows of this matrix scaled by the elements in the same row of the other.
 		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[0][col] * other[row][0] + m_rows[1][col] * other[row][1] + m_rows[2][col] * other[row][2] + m_rows[3][col] * other[row][3];
-			}
+			Simd::Store(result[row].m_elements, Simd::CombineRows(rows, Simd::Load(other[row].m_elements)));
 		}
 
 		return result;
@@ -101,12 +156,9 @@ namespace acid
 	Vector4 Matrix4::Multiply(const Vector4 &other) const
 	{
 		Vector4 result = Vector4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
-		}
-
+		Simd::Float4 rows[4];
+		LoadRows(*this, rows);
+		Simd::Store(result.m_elements, Simd::CombineRows(rows, Simd::Load(other.m_elements)));
 		return result;
 	}
 
@@ -127,14 +179,7 @@ namespace acid
 
 	Vector4 Matrix4::Transform(const Vector4 &other) const
 	{
-		Vector4 result = Vector4();
-
-		for (int32_t row = 0; row < 4; row++)
-		{
-			result[row] = m_rows[0][row] * other.m_x + m_rows[1][row] * other.m_y + m_rows[2][row] * other.m_z + m_rows[3][row] * other.m_w;
-		}
-
-		return result;
+		return Multiply(other);
 	}
 
 	Matrix4 Matrix4::Translate(const Vector2 &other) const
@@ -178,14 +223,11 @@ namespace acid
 
 	Matrix4 Matrix4::Scale(const Vector4 &other) const
 	{
-		Matrix4 result = Matrix4(*this);
+		Matrix4 result = Matrix4();
 
 		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] *= other[row];
-			}
+			Simd::Store(result[row].m_elements, Simd::Multiply(Simd::Load(m_rows[row].m_elements), Simd::Splat(other[row])));
 		}
 
 		return result;
@@ -233,10 +275,7 @@ namespace acid
 
 		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = -m_rows[row][col];
-			}
+			Simd::Store(result[row].m_elements, Simd::FlipSigns<true, true, true, true>(Simd::Load(m_rows[row].m_elements)));
 		}
 
 		return result;
@@ -244,25 +283,17 @@ namespace acid
 
 	Matrix4 Matrix4::Invert() const
 	{
-		Matrix4 result = Matrix4(*this);
+		Matrix4 result = Matrix4();
+		Simd::Float4 adjugate[4];
+		Adjugate(*this, adjugate);
 
-		float det = Determinant();
+		float det = AdjugateDeterminant(*this, adjugate);
 		assert(det != 0.0f && "Determinant cannot be zero!");
+		auto divisor = Simd::Splat(det);
 
-		for (int32_t j = 0; j < 4; j++)
+		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t i = 0; i < 4; i++)
-			{
-				// Get minor of element [j][i] - not [i][j], this is where the transpose happens.
-				Matrix3 minorSubmatrix = GetSubmatrix(j, i);
-				float minor = minorSubmatrix.Determinant();
-
-				// Multiply by (−1)^{i+j}.
-				float factor = ((i + j) % 2 == 1) ? -1.0f : 1.0f;
-				float cofactor = minor * factor;
-
-				result[i][j] = cofactor / det;
-			}
+			Simd::Store(result[row].m_elements, Simd::Divide(adjugate[row], divisor));
 		}
 
 		return result;
@@ -271,13 +302,13 @@ namespace acid
 	Matrix4 Matrix4::Transpose() const
 	{
 		Matrix4 result = Matrix4();
+		Simd::Float4 rows[4];
+		LoadRows(*this, rows);
+		Simd::Transpose(rows[0], rows[1], rows[2], rows[3]);
 
 		for (int32_t row = 0; row < 4; row++)
 		{
-			for (int32_t col = 0; col < 4; col++)
-			{
-				result[row][col] = m_rows[col][row];
-			}
+			Simd::Store(result[row].m_elements, rows[row]);
 		}
 
 		return result;
@@ -285,21 +316,9 @@ namespace acid
 
 	float Matrix4::Determinant() const
 	{
-		float result = 0.0f;
-
-		for (int32_t i = 0; i < 4; i++)
-		{
-			// Get minor of element [0][i].
-			Matrix3 minorSubmatrix = GetSubmatrix(0, i);
-			float minor = minorSubmatrix.Determinant();
-
-			// If this is an odd-numbered row, negate the value.
-			float factor = (i % 2 == 1) ? -1.0f : 1.0f;
-
-			result += factor * m_rows[0][i] * minor;
-		}
-
-		return result;
+		Simd::Float4 adjugate[4];
+		Adjugate(*this, adjugate);
+		return AdjugateDeterminant(*this, adjugate);
 	}
 
 	Matrix3 Matrix4::GetSubmatrix(const int32_t &row, const int32_t &col) const
@@ -332,31 +351,34 @@ namespace acid
 
 	Matrix4 Matrix4::TransformationMatrix(const Vector3 &translation, const Vector3 &rotation, const Vector3 &scale)
 	{
-		Matrix4 result = Matrix4();
-
-		if (translation.LengthSquared() != 0.0f)
-		{
-			result = result.Translate(translation);
-		}
-
-		if (rotation.LengthSquared() != 0.0f)
-		{
-			result = result.Rotate(Maths::Radians(rotation.m_x), Vector3::RIGHT); // Rotate the X component.
-			result = result.Rotate(Maths::Radians(rotation.m_y), Vector3::UP); // Rotate the Y component.
-			result = result.Rotate(Maths::Radians(rotation.m_z), Vector3::FRONT); // Rotate the Z component.
-		}
-
-		if (scale != Vector3::ONE)
-		{
-			result = result.Scale(scale);
-		}
+		// The product of translating, rotating around X, Y then Z, and scaling, written out so each angle only takes one sine and cosine.
+		float sx = std::sin(Maths::Radians(rotation.m_x));
+		float cx = std::cos(Maths::Radians(rotation.m_x));
+		float sy = std::sin(Maths::Radians(rotation.m_y));
+		float cy = std::cos(Maths::Radians(rotation.m_y));
+		float sz = std::sin(Maths::Radians(rotation.m_z));
+		float cz = std::cos(Maths::Radians(rotation.m_z));
 
+		Matrix4 result = Matrix4();
+		result[0][0] = cy * cz * scale.m_x;
+		result[0][1] = (sx * sy * cz + cx * sz) * scale.m_x;
+		result[0][2] = (sx * sz - cx * sy * cz) * scale.m_x;
+		result[1][0] = -cy * sz * scale.m_y;
+		result[1][1] = (cx * cz - sx * sy * sz) * scale.m_y;
+		result[1][2] = (cx * sy * sz + sx * cz) * scale.m_y;
+		result[2][0] = sy * scale.m_z;
+		result[2][1] = -sx * cy * scale.m_z;
+		result[2][2] = cx * cy * scale.m_z;
+		result[3][0] = translation.m_x;
+		result[3][1] = translation.m_y;
+		result[3][2] = translation.m_z;
 		return result;
 	}
 
 	Matrix4 Matrix4::TransformationMatrix(const Vector3 &translation, const Quaternion &rotation, const Vector3 &scale)
 	{
-		Matrix4 result = rotation.ToRotationMatrix();
+		// The same rows as the euler transformation matrix and transforms, each row is a rotated axis.
+		Matrix4 result = rotation.ToMatrix();
 
 		result[3][0] = translation.m_x;
 		result[3][1] = translation.m_y;
@@ -512,18 +534,6 @@ namespace acid
 		return Negate();
 	}
 
-	const Vector4 &Matrix4::operator[](const uint32_t &index) const
-	{
-		assert(index < 4);
-		return m_rows[index];
-	}
-
-	Vector4 &Matrix4::operator[](const uint32_t &index)
-	{
-		assert(index < 4);
-		return m_rows[index];
-	}
-
 	Matrix4 operator+(const Matrix4 &left, const Matrix4 &right)
 	{
 		return left.Add(right);
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cassert>
 #include <ostream>
 #include <string>
 #include "Vector3.hpp"
@@ -15,7 +16,7 @@ namespace acid
 	class Metadata;
 
 	/// <summary>
-	/// Holds a row major 4x4 matrix.
+	/// Holds a row major 4x4 matrix, rows are 16 byte aligned and the core operations run on <seealso cref="Simd"/> lanes.
 	/// </summary>
 	class ACID_EXPORT Matrix4
 	{
@@ -265,9 +266,17 @@ namespace acid
 
 		Matrix4 operator-() const;
 
-		const Vector4 &operator[](const uint32_t &index) const;
+		const Vector4 &operator[](const uint32_t &index) const
+		{
+			assert(index < 4);
+			return m_rows[index];
+		}
 
-		Vector4 &operator[](const uint32_t &index);
+		Vector4 &operator[](const uint32_t &index)
+		{
+			assert(index < 4);
+			return m_rows[index];
+		}
 
 		ACID_EXPORT friend Matrix4 operator+(const Matrix4 &left, const Matrix4 &right);
 
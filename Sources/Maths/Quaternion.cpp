@@ -5,6 +5,7 @@
 #include "Serialized/Metadata.hpp"
 #include "Matrix3.hpp"
 #include "Maths.hpp"
+#include "Simd.hpp"
 
 namespace acid
 {
@@ -131,10 +132,18 @@ namespace acid
 
 	Quaternion Quaternion::Multiply(const Quaternion &other) const
 	{
-		return Quaternion(m_x * other.m_w + m_w * other.m_x + m_y * other.m_z - m_z * other.m_y,
-			m_y * other.m_w + m_w * other.m_y + m_z * other.m_x - m_x * other.m_z,
-			m_z * other.m_w + m_w * other.m_z + m_x * other.m_y - m_y * other.m_x,
-			m_w * other.m_w - m_x * other.m_x - m_y * other.m_y - m_z * other.m_z);
+		auto left = Simd::Load(m_elements);
+		auto right = Simd::Load(other.m_elements);
+
+		// The four products of each element are added in the same order as the written out product, subtracting is adding a negated lane.
+		auto result = Simd::Multiply(left, Simd::Splat<3>(right));
+		result = Simd::Add(result, Simd::FlipSigns<false, false, false, true>(Simd::Multiply(Simd::Shuffle<3, 3, 3, 0>(left), Simd::Shuffle<0, 1, 2, 0>(right))));
+		result = Simd::Add(result, Simd::FlipSigns<false, false, false, true>(Simd::Multiply(Simd::Shuffle<1, 2, 0, 1>(left), Simd::Shuffle<2, 0, 1, 1>(right))));
+		result = Simd::Subtract(result, Simd::Multiply(Simd::Shuffle<2, 0, 1, 2>(left), Simd::Shuffle<1, 2, 0, 2>(right)));
+
+		Quaternion quaternion = Quaternion();
+		Simd::Store(quaternion.m_elements, result);
+		return quaternion;
 	}
 
 	Vector3 Quaternion::Multiply(const Vector3 &other) const
@@ -163,7 +172,9 @@ namespace acid
 
 	Quaternion Quaternion::Slerp(const Quaternion &other, const float &progression)
 	{
-		float cosom = m_x * other.m_x + m_y * other.m_y + m_z * other.m_z + m_w * other.m_w;
+		auto left = Simd::Load(m_elements);
+		auto right = Simd::Load(other.m_elements);
+		float cosom = Simd::Sum(Simd::Multiply(left, right));
 		float absCosom = std::abs(cosom);
 		float scale0, scale1;
 
@@ -183,10 +194,7 @@ namespace acid
 
 		scale1 = cosom >= 0.0f ? scale1 : -scale1;
 		Quaternion result = Quaternion();
-		result.m_x = scale0 * m_x + scale1 * other.m_x;
-		result.m_y = scale0 * m_y + scale1 * other.m_y;
-		result.m_z = scale0 * m_z + scale1 * other.m_z;
-		result.m_w = scale0 * m_w + scale1 * other.m_w;
+		Simd::Store(result.m_elements, Simd::Add(Simd::Multiply(Simd::Splat(scale0), left), Simd::Multiply(Simd::Splat(scale1), right)));
 		return result;
 	}
 
@@ -311,7 +319,7 @@ namespace acid
 
 	bool Quaternion::operator==(const Quaternion &other) const
 	{
-		return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z && m_w == other.m_w;
+		return m_x == other.m_x && m_y == other.m_y && m_z == other.m_z && m_w == other.m_w;
 	}
 
 	bool Quaternion::operator!=(const Quaternion &other) const
@@ -26,7 +26,7 @@ namespace acid
 
 			struct
 			{
-				float m_elements[4];
+				alignas(16) float m_elements[4];
 			};
 		};
 
@@ -186,7 +186,7 @@ namespace acid
 
 		/// <summary>
 		/// Converts this quaternion to a 3x3 matrix representing the exact same
-		/// rotation as this quaternion.
+		/// rotation as this quaternion. This is the transpose of <seealso cref="#ToMatrix()"/>, as used by joint transforms.
 		/// </summary>
 		/// <returns> The rotation matrix which represents the exact same rotation as this quaternion. </returns>
 		Matrix4 ToRotationMatrix() const;
@@ -0,0 +1,192 @@
+#include "RandomStream.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <random>
+#include "Batch.hpp"
+#include "Maths.hpp"
+#include "Matrix4.hpp"
+#include "Simd.hpp"
+#include "Vector3.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// Steps a SplitMix64 generator, used to spread one seed over every generator state.
+	/// </summary>
+	static uint64_t SplitMix(uint64_t &state)
+	{
+		uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+		return z ^ (z >> 31);
+	}
+
+	/// <summary>
+	/// Turns the top 24 random bits into a value from zero up to one, the same as <seealso cref="RandomStream#Next"/>.
+	/// </summary>
+	static float ToUnit(const uint32_t &bits)
+	{
+		return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+	}
+
+	static Vector3 UnitVectorAboveZ(const float &zUnit, const float &thetaUnit, const float &minZ)
+	{
+		float z = minZ + (1.0f - minZ) * zUnit;
+		float theta = 2.0f * PI * thetaUnit;
+		float rootOneMinusZSquared = std::sqrt(std::max(1.0f - z * z, 0.0f));
+		return Vector3(rootOneMinusZSquared * std::cos(theta), rootOneMinusZSquared * std::sin(theta), z);
+	}
+
+	/// <summary>
+	/// Gets the rotation from the front axis to a cone direction, its rows are a basis with the direction last.
+	/// </summary>
+	static Matrix4 ConeRotation(const Vector3 &coneDirection)
+	{
+		Vector3 direction = coneDirection.Normalize();
+		Vector3 side = (std::fabs(direction.m_y) < 0.99f ? Vector3::UP : Vector3::RIGHT).Cross(direction).Normalize();
+		Matrix4 rotation = Matrix4::IDENTITY;
+		rotation[0] = Vector4(side, 0.0f);
+		rotation[1] = Vector4(direction.Cross(side), 0.0f);
+		rotation[2] = Vector4(direction, 0.0f);
+		return rotation;
+	}
+
+	static uint64_t NextThreadSeed()
+	{
+		// The base changes every run, and each thread asking gets the next seed after it.
+		static const uint64_t base = static_cast<uint64_t>(std::random_device()()) << 32 | std::random_device()();
+		static std::atomic<uint64_t> threads(0);
+		return base + threads++;
+	}
+
+	RandomStream::RandomStream(const uint64_t &seed) :
+		m_state(),
+		m_lanes()
+	{
+		Seed(seed);
+	}
+
+	RandomStream &RandomStream::Get()
+	{
+		static thread_local RandomStream stream = RandomStream(NextThreadSeed());
+		return stream;
+	}
+
+	void RandomStream::Seed(const uint64_t &seed)
+	{
+		uint64_t state = seed;
+
+		for (uint32_t i = 0; i < 4; i += 2)
+		{
+			uint64_t value = SplitMix(state);
+			m_state[i] = static_cast<uint32_t>(value);
+			m_state[i + 1] = static_cast<uint32_t>(value >> 32);
+		}
+
+		for (uint32_t lane = 0; lane < 4; lane++)
+		{
+			for (uint32_t i = 0; i < 4; i += 2)
+			{
+				uint64_t value = SplitMix(state);
+				m_lanes[i][lane] = static_cast<uint32_t>(value);
+				m_lanes[i + 1][lane] = static_cast<uint32_t>(value >> 32);
+			}
+		}
+	}
+
+	uint32_t RandomStream::NextIndex(const uint32_t &count)
+	{
+		return static_cast<uint32_t>((static_cast<uint64_t>(NextUint()) * count) >> 32);
+	}
+
+	float RandomStream::NextNormal(const float &standardDeviation, const float &mean)
+	{
+		// The first value is moved away from zero, so its log is always finite.
+		float u = 1.0f - ToUnit(NextUint());
+		float v = ToUnit(NextUint());
+		return mean + standardDeviation * std::sqrt(-2.0f * std::log(u)) * std::cos(2.0f * PI * v);
+	}
+
+	Vector3 RandomStream::NextUnitVector()
+	{
+		float z = ToUnit(NextUint());
+		return UnitVectorAboveZ(z, ToUnit(NextUint()), -1.0f);
+	}
+
+	Vector3 RandomStream::NextUnitVectorWithinCone(const Vector3 &coneDirection, const float &angle)
+	{
+		float z = ToUnit(NextUint());
+		Vector3 direction = UnitVectorAboveZ(z, ToUnit(NextUint()), std::cos(angle));
+		return Vector3(ConeRotation(coneDirection).Transform(Vector4(direction, 0.0f)));
+	}
+
+	void RandomStream::Fill(float *values, const std::size_t &count, const float &min, const float &max)
+	{
+		auto minimum = Simd::Splat(min);
+		auto range = Simd::Splat(max - min);
+		auto unit = Simd::Splat(1.0f / 16777216.0f);
+
+		for (std::size_t i = 0; i < count; i += 4)
+		{
+			uint32_t bits[4];
+			NextLanes(bits);
+
+			// The same rounding as ToUnit and Next, so the last values can be copied from the lanes.
+			float lanes[4];
+			auto value = Simd::Multiply(Simd::ToFloat(Simd::ShiftRight<8>(Simd::LoadInt(bits))), unit);
+			Simd::Store(lanes, Simd::Add(minimum, Simd::Multiply(range, value)));
+			std::copy(lanes, lanes + std::min<std::size_t>(4, count - i), values + i);
+		}
+	}
+
+	void RandomStream::FillUnitVectors(Vector3 *vectors, const std::size_t &count)
+	{
+		FillUnitVectorsAboveZ(vectors, count, -1.0f);
+	}
+
+	void RandomStream::FillUnitVectorsWithinCone(Vector3 *vectors, const std::size_t &count, const Vector3 &coneDirection, const float &angle)
+	{
+		// Every vector is made around the front axis, then they are all turned to the cone by one matrix.
+		FillUnitVectorsAboveZ(vectors, count, std::cos(angle));
+		Batch::TransformDirections(ConeRotation(coneDirection), vectors, vectors, count);
+	}
+
+	void RandomStream::NextLanes(uint32_t values[4])
+	{
+		// The same steps as NextUint, with a generator in each lane.
+		auto s0 = Simd::LoadInt(m_lanes[0]);
+		auto s1 = Simd::LoadInt(m_lanes[1]);
+		auto s2 = Simd::LoadInt(m_lanes[2]);
+		auto s3 = Simd::LoadInt(m_lanes[3]);
+		Simd::StoreInt(values, Simd::AddInt(s0, s3));
+		auto t = Simd::ShiftLeft<9>(s1);
+		s2 = Simd::Xor(s2, s0);
+		s3 = Simd::Xor(s3, s1);
+		s1 = Simd::Xor(s1, s2);
+		s0 = Simd::Xor(s0, s3);
+		s2 = Simd::Xor(s2, t);
+		s3 = Simd::Xor(Simd::ShiftLeft<11>(s3), Simd::ShiftRight<21>(s3));
+		Simd::StoreInt(m_lanes[0], s0);
+		Simd::StoreInt(m_lanes[1], s1);
+		Simd::StoreInt(m_lanes[2], s2);
+		Simd::StoreInt(m_lanes[3], s3);
+	}
+
+	void RandomStream::FillUnitVectorsAboveZ(Vector3 *vectors, const std::size_t &count, const float &minZ)
+	{
+		for (std::size_t i = 0; i < count; i += 4)
+		{
+			uint32_t zs[4];
+			uint32_t thetas[4];
+			NextLanes(zs);
+			NextLanes(thetas);
+
+			for (std::size_t lane = 0; lane < std::min<std::size_t>(4, count - i); lane++)
+			{
+				vectors[i + lane] = UnitVectorAboveZ(ToUnit(zs[lane]), ToUnit(thetas[lane]), minZ);
+			}
+		}
+	}
+}
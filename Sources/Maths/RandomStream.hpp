@@ -0,0 +1,150 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	class Vector3;
+
+	/// <summary>
+	/// A seedable stream of random numbers using xoshiro128+, the same seed always gives the same numbers.
+	/// A stream is not shared between threads, each thread has its own from <seealso cref="#Get"/>.
+	/// Bulk fills draw from four more generators kept apart from the single values, and step them together so the loops vectorize.
+	/// </summary>
+	class ACID_EXPORT RandomStream
+	{
+	private:
+		uint32_t m_state[4];
+		uint32_t m_lanes[4][4];
+	public:
+		using result_type = uint32_t;
+
+		/// <summary>
+		/// Creates a new random stream.
+		/// </summary>
+		/// <param name="seed"> The seed. </param>
+		explicit RandomStream(const uint64_t &seed = 0);
+
+		/// <summary>
+		/// Gets the stream of the calling thread, each thread is seeded differently the first time it asks.
+		/// </summary>
+		/// <returns> The threads stream. </returns>
+		static RandomStream &Get();
+
+		/// <summary>
+		/// Restarts the stream from a seed.
+		/// </summary>
+		/// <param name="seed"> The seed. </param>
+		void Seed(const uint64_t &seed);
+
+		/// <summary>
+		/// Generates the next 32 random bits.
+		/// </summary>
+		/// <returns> The random bits. </returns>
+		uint32_t NextUint()
+		{
+			uint32_t result = m_state[0] + m_state[3];
+			uint32_t t = m_state[1] << 9;
+			m_state[2] ^= m_state[0];
+			m_state[3] ^= m_state[1];
+			m_state[1] ^= m_state[2];
+			m_state[0] ^= m_state[3];
+			m_state[2] ^= t;
+			m_state[3] = (m_state[3] << 11) | (m_state[3] >> 21);
+			return result;
+		}
+
+		/// <summary>
+		/// Generates a random value from between a range.
+		/// </summary>
+		/// <param name="min"> The min value. </param>
+		/// <param name="max"> The max value. </param>
+		/// <returns> The randomly selected value within the range. </returns>
+		float Next(const float &min = 0.0f, const float &max = 1.0f)
+		{
+			// The top 24 bits are used, every value from zero up to one is exact in a float.
+			return min + (max - min) * (static_cast<float>(NextUint() >> 8) * (1.0f / 16777216.0f));
+		}
+
+		/// <summary>
+		/// Generates a random index below a count.
+		/// </summary>
+		/// <param name="count"> The amount of indices, must not be zero. </param>
+		/// <returns> The randomly selected index. </returns>
+		uint32_t NextIndex(const uint32_t &count);
+
+		/// <summary>
+		/// Generates a single value from a normal distribution, using Box-Muller.
+		/// </summary>
+		/// <param name="standardDeviation"> The standards deviation of the distribution. </param>
+		/// <param name="mean"> The mean of the distribution. </param>
+		/// <returns> A normally distributed value. </returns>
+		float NextNormal(const float &standardDeviation, const float &mean);
+
+		/// <summary>
+		/// Generates a random direction.
+		/// </summary>
+		/// <returns> The unit vector. </returns>
+		Vector3 NextUnitVector();
+
+		/// <summary>
+		/// Generates a random direction no further than a angle from a cone direction.
+		/// </summary>
+		/// <param name="coneDirection"> The cones direction. </param>
+		/// <param name="angle"> The cones half angle, in radians. </param>
+		/// <returns> The unit vector. </returns>
+		Vector3 NextUnitVectorWithinCone(const Vector3 &coneDirection, const float &angle);
+
+		/// <summary>
+		/// Fills values from between a range.
+		/// </summary>
+		/// <param name="values"> The values to fill. </param>
+		/// <param name="count"> The amount of values. </param>
+		/// <param name="min"> The min value. </param>
+		/// <param name="max"> The max value. </param>
+		void Fill(float *values, const std::size_t &count, const float &min = 0.0f, const float &max = 1.0f);
+
+		/// <summary>
+		/// Fills random directions.
+		/// </summary>
+		/// <param name="vectors"> The unit vectors to fill. </param>
+		/// <param name="count"> The amount of vectors. </param>
+		void FillUnitVectors(Vector3 *vectors, const std::size_t &count);
+
+		/// <summary>
+		/// Fills random directions no further than a angle from a cone direction.
+		/// </summary>
+		/// <param name="vectors"> The unit vectors to fill. </param>
+		/// <param name="count"> The amount of vectors. </param>
+		/// <param name="coneDirection"> The cones direction. </param>
+		/// <param name="angle"> The cones half angle, in radians. </param>
+		void FillUnitVectorsWithinCone(Vector3 *vectors, const std::size_t &count, const Vector3 &coneDirection, const float &angle);
+
+		static constexpr result_type min() { return 0; }
+
+		static constexpr result_type max() { return UINT32_MAX; }
+
+		/// <summary>
+		/// Generates the next 32 random bits, so the stream can be used with the standard distributions.
+		/// </summary>
+		/// <returns> The random bits. </returns>
+		result_type operator()() { return NextUint(); }
+
+	private:
+		/// <summary>
+		/// Steps the four bulk generators together.
+		/// </summary>
+		/// <param name="values"> The next value of each generator. </param>
+		void NextLanes(uint32_t values[4]);
+
+		/// <summary>
+		/// Fills unit vectors around the front axis, with a z no lower than a minimum.
+		/// </summary>
+		/// <param name="vectors"> The unit vectors to fill. </param>
+		/// <param name="count"> The amount of vectors. </param>
+		/// <param name="minZ"> The lowest z, -1 covers every direction. </param>
+		void FillUnitVectorsAboveZ(Vector3 *vectors, const std::size_t &count, const float &minZ);
+	};
+}
@@ -0,0 +1,423 @@
+#pragma once
+
+#include <cstdint>
+#if !defined(ACID_SIMD_SCALAR)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ACID_SIMD_SSE
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define ACID_SIMD_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace acid
+{
+	/// <summary>
+	/// Operations on four float or unsigned integer lanes at once, SSE2 is used on x86, NEON on ARM, and plain arrays on other targets or when ACID_SIMD_SCALAR is defined.
+	/// Each lane is rounded once per operation like the scalar expression it replaces, so every backend gives the same bits unless the compiler fuses multiplies into adds.
+	/// </summary>
+	class Simd
+	{
+	public:
+#if defined(ACID_SIMD_SSE)
+		using Float4 = __m128;
+#elif defined(ACID_SIMD_NEON)
+		using Float4 = float32x4_t;
+#else
+		struct Float4
+		{
+			float m_lanes[4];
+		};
+#endif
+#if defined(ACID_SIMD_SSE)
+		using Int4 = __m128i;
+#elif defined(ACID_SIMD_NEON)
+		using Int4 = uint32x4_t;
+#else
+		struct Int4
+		{
+			uint32_t m_lanes[4];
+		};
+#endif
+
+		/// <summary>
+		/// Loads four floats, the source does not need to be aligned.
+		/// </summary>
+		/// <param name="source"> The floats to load. </param>
+		/// <returns> The lanes. </returns>
+		static Float4 Load(const float *source)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_loadu_ps(source);
+#elif defined(ACID_SIMD_NEON)
+			return vld1q_f32(source);
+#else
+			return {{source[0], source[1], source[2], source[3]}};
+#endif
+		}
+
+		/// <summary>
+		/// Stores four floats, the destination does not need to be aligned.
+		/// </summary>
+		/// <param name="destination"> The floats to store into. </param>
+		/// <param name="value"> The lanes. </param>
+		static void Store(float *destination, const Float4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			_mm_storeu_ps(destination, value);
+#elif defined(ACID_SIMD_NEON)
+			vst1q_f32(destination, value);
+#else
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				destination[i] = value.m_lanes[i];
+			}
+#endif
+		}
+
+		static Float4 Set(const float &x, const float &y, const float &z, const float &w)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_setr_ps(x, y, z, w);
+#else
+			const float lanes[4] = {x, y, z, w};
+			return Load(lanes);
+#endif
+		}
+
+		static Float4 Splat(const float &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_set1_ps(value);
+#elif defined(ACID_SIMD_NEON)
+			return vdupq_n_f32(value);
+#else
+			return {{value, value, value, value}};
+#endif
+		}
+
+		static Float4 Add(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_add_ps(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return vaddq_f32(left, right);
+#else
+			return {{left.m_lanes[0] + right.m_lanes[0], left.m_lanes[1] + right.m_lanes[1], left.m_lanes[2] + right.m_lanes[2], left.m_lanes[3] + right.m_lanes[3]}};
+#endif
+		}
+
+		static Float4 Subtract(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_sub_ps(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return vsubq_f32(left, right);
+#else
+			return {{left.m_lanes[0] - right.m_lanes[0], left.m_lanes[1] - right.m_lanes[1], left.m_lanes[2] - right.m_lanes[2], left.m_lanes[3] - right.m_lanes[3]}};
+#endif
+		}
+
+		static Float4 Multiply(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_mul_ps(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return vmulq_f32(left, right);
+#else
+			return {{left.m_lanes[0] * right.m_lanes[0], left.m_lanes[1] * right.m_lanes[1], left.m_lanes[2] * right.m_lanes[2], left.m_lanes[3] * right.m_lanes[3]}};
+#endif
+		}
+
+		static Float4 Divide(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_div_ps(left, right);
+#elif defined(ACID_SIMD_NEON) && defined(__aarch64__)
+			return vdivq_f32(left, right);
+#else
+			float a[4], b[4];
+			Store(a, left);
+			Store(b, right);
+			return Set(a[0] / b[0], a[1] / b[1], a[2] / b[2], a[3] / b[3]);
+#endif
+		}
+
+		static Float4 Min(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_min_ps(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return vminq_f32(left, right);
+#else
+			return {{left.m_lanes[0] < right.m_lanes[0] ? left.m_lanes[0] : right.m_lanes[0], left.m_lanes[1] < right.m_lanes[1] ? left.m_lanes[1] : right.m_lanes[1],
+				left.m_lanes[2] < right.m_lanes[2] ? left.m_lanes[2] : right.m_lanes[2], left.m_lanes[3] < right.m_lanes[3] ? left.m_lanes[3] : right.m_lanes[3]}};
+#endif
+		}
+
+		static Float4 Max(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_max_ps(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return vmaxq_f32(left, right);
+#else
+			return {{left.m_lanes[0] > right.m_lanes[0] ? left.m_lanes[0] : right.m_lanes[0], left.m_lanes[1] > right.m_lanes[1] ? left.m_lanes[1] : right.m_lanes[1],
+				left.m_lanes[2] > right.m_lanes[2] ? left.m_lanes[2] : right.m_lanes[2], left.m_lanes[3] > right.m_lanes[3] ? left.m_lanes[3] : right.m_lanes[3]}};
+#endif
+		}
+
+		/// <summary>
+		/// Loads four unsigned integers, the source does not need to be aligned.
+		/// </summary>
+		/// <param name="source"> The integers to load. </param>
+		/// <returns> The lanes. </returns>
+		static Int4 LoadInt(const uint32_t *source)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+#elif defined(ACID_SIMD_NEON)
+			return vld1q_u32(source);
+#else
+			return {{source[0], source[1], source[2], source[3]}};
+#endif
+		}
+
+		/// <summary>
+		/// Stores four unsigned integers, the destination does not need to be aligned.
+		/// </summary>
+		/// <param name="destination"> The integers to store into. </param>
+		/// <param name="value"> The lanes. </param>
+		static void StoreInt(uint32_t *destination, const Int4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(destination), value);
+#elif defined(ACID_SIMD_NEON)
+			vst1q_u32(destination, value);
+#else
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				destination[i] = value.m_lanes[i];
+			}
+#endif
+		}
+
+		/// <summary>
+		/// Adds unsigned integer lanes, wrapping on overflow.
+		/// </summary>
+		static Int4 AddInt(const Int4 &left, const Int4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_add_epi32(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return vaddq_u32(left, right);
+#else
+			return {{left.m_lanes[0] + right.m_lanes[0], left.m_lanes[1] + right.m_lanes[1], left.m_lanes[2] + right.m_lanes[2], left.m_lanes[3] + right.m_lanes[3]}};
+#endif
+		}
+
+		static Int4 Xor(const Int4 &left, const Int4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_xor_si128(left, right);
+#elif defined(ACID_SIMD_NEON)
+			return veorq_u32(left, right);
+#else
+			return {{left.m_lanes[0] ^ right.m_lanes[0], left.m_lanes[1] ^ right.m_lanes[1], left.m_lanes[2] ^ right.m_lanes[2], left.m_lanes[3] ^ right.m_lanes[3]}};
+#endif
+		}
+
+		/// <summary>
+		/// Shifts every unsigned integer lane towards its high bits.
+		/// </summary>
+		/// <param name="Bits"> The amount of bits, from 1 to 31. </param>
+		template<uint32_t Bits>
+		static Int4 ShiftLeft(const Int4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_slli_epi32(value, Bits);
+#elif defined(ACID_SIMD_NEON)
+			return vshlq_n_u32(value, Bits);
+#else
+			return {{value.m_lanes[0] << Bits, value.m_lanes[1] << Bits, value.m_lanes[2] << Bits, value.m_lanes[3] << Bits}};
+#endif
+		}
+
+		/// <summary>
+		/// Shifts every unsigned integer lane towards its low bits, filling with zeros.
+		/// </summary>
+		/// <param name="Bits"> The amount of bits, from 1 to 31. </param>
+		template<uint32_t Bits>
+		static Int4 ShiftRight(const Int4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_srli_epi32(value, Bits);
+#elif defined(ACID_SIMD_NEON)
+			return vshrq_n_u32(value, Bits);
+#else
+			return {{value.m_lanes[0] >> Bits, value.m_lanes[1] >> Bits, value.m_lanes[2] >> Bits, value.m_lanes[3] >> Bits}};
+#endif
+		}
+
+		/// <summary>
+		/// Converts unsigned integer lanes below 2^24 to floats, which is exact.
+		/// </summary>
+		/// <param name="value"> The integer lanes. </param>
+		/// <returns> The float lanes. </returns>
+		static Float4 ToFloat(const Int4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_cvtepi32_ps(value);
+#elif defined(ACID_SIMD_NEON)
+			return vcvtq_f32_u32(value);
+#else
+			return {{static_cast<float>(value.m_lanes[0]), static_cast<float>(value.m_lanes[1]), static_cast<float>(value.m_lanes[2]),
+				static_cast<float>(value.m_lanes[3])}};
+#endif
+		}
+
+		/// <summary>
+		/// Compares each lane, a lane holding NaN is never less or equal.
+		/// </summary>
+		/// <param name="left"> The left value. </param>
+		/// <param name="right"> The right value. </param>
+		/// <returns> A bit for each lane where left is less or equal to right, the first lane in the lowest bit. </returns>
+		static uint32_t LessEqual(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return static_cast<uint32_t>(_mm_movemask_ps(_mm_cmple_ps(left, right)));
+#elif defined(ACID_SIMD_NEON)
+			const uint32_t bits[4] = {1u, 2u, 4u, 8u};
+			uint32_t lanes[4];
+			vst1q_u32(lanes, vandq_u32(vcleq_f32(left, right), vld1q_u32(bits)));
+			return lanes[0] | lanes[1] | lanes[2] | lanes[3];
+#else
+			uint32_t result = 0;
+
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				result |= left.m_lanes[i] <= right.m_lanes[i] ? 1u << i : 0u;
+			}
+
+			return result;
+#endif
+		}
+
+		/// <summary>
+		/// Reorders the lanes of a value.
+		/// </summary>
+		/// <param name="value"> The value. </param>
+		/// <param name="X"> The lane of the value placed in the first lane, and so on for Y, Z and W. </param>
+		/// <returns> The reordered lanes. </returns>
+		template<uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+		static Float4 Shuffle(const Float4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_shuffle_ps(value, value, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(ACID_SIMD_NEON)
+			return Set(vgetq_lane_f32(value, X), vgetq_lane_f32(value, Y), vgetq_lane_f32(value, Z), vgetq_lane_f32(value, W));
+#else
+			return {{value.m_lanes[X], value.m_lanes[Y], value.m_lanes[Z], value.m_lanes[W]}};
+#endif
+		}
+
+		/// <summary>
+		/// Takes the first two lanes from one value and the last two from another.
+		/// </summary>
+		/// <param name="left"> The value the first two lanes come from. </param>
+		/// <param name="right"> The value the last two lanes come from. </param>
+		/// <param name="X"> The lane of the left value placed in the first lane, and so on for Y, then Z and W from the right value. </param>
+		/// <returns> The combined lanes. </returns>
+		template<uint32_t X, uint32_t Y, uint32_t Z, uint32_t W>
+		static Float4 Shuffle(const Float4 &left, const Float4 &right)
+		{
+#if defined(ACID_SIMD_SSE)
+			return _mm_shuffle_ps(left, right, _MM_SHUFFLE(W, Z, Y, X));
+#elif defined(ACID_SIMD_NEON)
+			return Set(vgetq_lane_f32(left, X), vgetq_lane_f32(left, Y), vgetq_lane_f32(right, Z), vgetq_lane_f32(right, W));
+#else
+			return {{left.m_lanes[X], left.m_lanes[Y], right.m_lanes[Z], right.m_lanes[W]}};
+#endif
+		}
+
+		/// <summary>
+		/// Copies one lane of a value into every lane.
+		/// </summary>
+		/// <param name="value"> The value. </param>
+		/// <param name="Lane"> The lane to copy. </param>
+		/// <returns> The copied lane. </returns>
+		template<uint32_t Lane>
+		static Float4 Splat(const Float4 &value)
+		{
+#if defined(ACID_SIMD_NEON) && defined(__aarch64__)
+			return vdupq_laneq_f32(value, Lane);
+#else
+			return Shuffle<Lane, Lane, Lane, Lane>(value);
+#endif
+		}
+
+		/// <summary>
+		/// Negates some lanes of a value by flipping their sign bits, which is exact.
+		/// </summary>
+		/// <param name="value"> The value. </param>
+		/// <param name="X"> If the first lane is negated, and so on for Y, Z and W. </param>
+		/// <returns> The value with the lanes negated. </returns>
+		template<bool X, bool Y, bool Z, bool W>
+		static Float4 FlipSigns(const Float4 &value)
+		{
+#if defined(ACID_SIMD_SSE)
+			const auto mask = _mm_castsi128_ps(_mm_setr_epi32(X ? INT32_MIN : 0, Y ? INT32_MIN : 0, Z ? INT32_MIN : 0, W ? INT32_MIN : 0));
+			return _mm_xor_ps(value, mask);
+#elif defined(ACID_SIMD_NEON)
+			const uint32_t lanes[4] = {X ? 0x80000000u : 0u, Y ? 0x80000000u : 0u, Z ? 0x80000000u : 0u, W ? 0x80000000u : 0u};
+			return vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(value), vld1q_u32(lanes)));
+#else
+			return {{X ? -value.m_lanes[0] : value.m_lanes[0], Y ? -value.m_lanes[1] : value.m_lanes[1], Z ? -value.m_lanes[2] : value.m_lanes[2],
+				W ? -value.m_lanes[3] : value.m_lanes[3]}};
+#endif
+		}
+
+		/// <summary>
+		/// Adds the lanes of a value together in order, as ((x + y) + z) + w.
+		/// </summary>
+		/// <param name="value"> The value. </param>
+		/// <returns> The sum. </returns>
+		static float Sum(const Float4 &value)
+		{
+			float lanes[4];
+			Store(lanes, value);
+			return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+		}
+
+		/// <summary>
+		/// Adds four rows scaled by the lanes of a value in order, as ((x * row0 + y * row1) + z * row2) + w * row3.
+		/// This is a row vector multiplied by a <seealso cref="Matrix4"/>, and each row of a product of two.
+		/// </summary>
+		/// <param name="rows"> The rows. </param>
+		/// <param name="scales"> The value whose lanes scale each row. </param>
+		/// <returns> The combined row. </returns>
+		static Float4 CombineRows(const Float4 rows[4], const Float4 &scales)
+		{
+			auto result = Multiply(Splat<0>(scales), rows[0]);
+			result = Add(result, Multiply(Splat<1>(scales), rows[1]));
+			result = Add(result, Multiply(Splat<2>(scales), rows[2]));
+			return Add(result, Multiply(Splat<3>(scales), rows[3]));
+		}
+
+		/// <summary>
+		/// Transposes four rows in place.
+		/// </summary>
+		static void Transpose(Float4 &row0, Float4 &row1, Float4 &row2, Float4 &row3)
+		{
+			auto t0 = Shuffle<0, 1, 0, 1>(row0, row1);
+			auto t1 = Shuffle<2, 3, 2, 3>(row0, row1);
+			auto t2 = Shuffle<0, 1, 0, 1>(row2, row3);
+			auto t3 = Shuffle<2, 3, 2, 3>(row2, row3);
+			row0 = Shuffle<0, 2, 0, 2>(t0, t2);
+			row1 = Shuffle<1, 3, 1, 3>(t0, t2);
+			row2 = Shuffle<0, 2, 0, 2>(t1, t3);
+			row3 = Shuffle<1, 3, 1, 3>(t1, t3);
+		}
+	};
+}
@@ -6,8 +6,8 @@
 namespace acid
 {
 	const Time Time::ZERO = Time();
-	const Time Time::NEGATIVE_INFINITY = Time(-std::numeric_limits<int64_t>::infinity());
-	const Time Time::POSITIVE_INFINITY = Time(+std::numeric_limits<int64_t>::infinity());
+	const Time Time::NEGATIVE_INFINITY = Time(std::numeric_limits<int64_t>::lowest());
+	const Time Time::POSITIVE_INFINITY = Time(std::numeric_limits<int64_t>::max());
 
 	Time::Time(const int64_t &microseconds) :
 		m_microseconds(microseconds)
@@ -20,6 +20,11 @@ namespace acid
 		return GetDifference() >= m_interval;
 	}
 
+	Time Timer::GetRemaining() const
+	{
+		return m_interval - GetDifference();
+	}
+
 	void Timer::ResetStartTime()
 	{
 		m_startTime = Engine::GetTime();
@@ -32,6 +32,12 @@ namespace acid
 		/// <returns> If the interval was exceeded. </returns>
 		bool IsPassedTime() const;
 
+		/// <summary>
+		/// Gets the amount of time left until the interval has passed, negative once it has passed.
+		/// </summary>
+		/// <returns> The time until the interval passes. </returns>
+		Time GetRemaining() const;
+
 		/// <summary>
 		/// Adds the intervals value to the start time.
 		/// </summary>
@@ -1,78 +1,116 @@
 ﻿#include "Transform.hpp"
 
 #include "Network/Packet.hpp"
-#include "Scenes/Entity.hpp"
 #include "Serialized/Metadata.hpp"
-#include "Quaternion.hpp"
 
 namespace acid
 {
 	const Transform Transform::IDENTITY = Transform();
 
+	Transform::Transform(const Vector3 &position, const Quaternion &rotation, const Vector3 &scaling) :
+		m_rotation(rotation),
+		m_position(position),
+		m_scaling(scaling),
+		m_dirty(true)
+	{
+	}
+
 	Transform::Transform(const Vector3 &position, const Vector3 &rotation, const Vector3 &scaling) :
+		m_rotation(Quaternion(rotation.m_x, rotation.m_y, rotation.m_z)),
 		m_position(position),
-		m_rotation(rotation),
 		m_scaling(scaling),
-		m_worldMatrix(Matrix4()),
 		m_dirty(true)
 	{
 	}
 
 	Transform::Transform(const Vector3 &position, const Vector3 &rotation, const float &scale) :
+		m_rotation(Quaternion(rotation.m_x, rotation.m_y, rotation.m_z)),
 		m_position(position),
-		m_rotation(rotation),
 		m_scaling(Vector3(scale, scale, scale)),
-		m_worldMatrix(Matrix4()),
 		m_dirty(true)
 	{
 	}
 
 	Transform::Transform(const Transform &source) :
-		m_position(source.m_position),
 		m_rotation(source.m_rotation),
+		m_position(source.m_position),
 		m_scaling(source.m_scaling),
-		m_worldMatrix(Matrix4()),
 		m_dirty(true)
 	{
 	}
 
-	void Transform::Start()
-	{
-	}
-
-	void Transform::Update()
-	{
-	}
-
 	void Transform::Decode(const Metadata &metadata)
 	{
 		m_position = metadata.GetChild<Vector3>("Position");
-		m_rotation = metadata.GetChild<Vector3>("Rotation");
 		m_scaling = metadata.GetChild<Vector3>("Scaling");
+
+		// Rotations are written as quaternions, older files and hand written rotations without a w are euler angles.
+		auto rotation = metadata.FindChild("Rotation", false);
+
+		if (rotation != nullptr && rotation->FindChild("w", false) != nullptr)
+		{
+			m_rotation = rotation->Get<Quaternion>();
+		}
+		else
+		{
+			SetEulerRotation(metadata.GetChild<Vector3>("Rotation"));
+		}
+
 		m_dirty = true;
 	}
 
 	void Transform::Encode(Metadata &metadata) const
 	{
+		// Euler angles lose the rotation around the other axes when the middle angle is near 90 degrees, quaternions keep it.
 		metadata.SetChild<Vector3>("Position", m_position);
-		metadata.SetChild<Vector3>("Rotation", m_rotation);
+		metadata.SetChild<Quaternion>("Rotation", m_rotation);
 		metadata.SetChild<Vector3>("Scaling", m_scaling);
 	}
 
 	Transform Transform::Multiply(const Transform &other) const
 	{
-		return Transform(GetWorldMatrix().Transform(other.m_position), m_rotation + other.m_rotation, m_scaling * other.m_scaling);
+		// The others position is scaled and rotated into this space, the same as transforming it by this transforms matrix.
+		// The rotation is the quaternion sandwich product, written out as p + 2 * (w * (q x p) + q x (q x p)).
+		float px = m_scaling.m_x * other.m_position.m_x;
+		float py = m_scaling.m_y * other.m_position.m_y;
+		float pz = m_scaling.m_z * other.m_position.m_z;
+		float cx = m_rotation.m_y * pz - m_rotation.m_z * py;
+		float cy = m_rotation.m_z * px - m_rotation.m_x * pz;
+		float cz = m_rotation.m_x * py - m_rotation.m_y * px;
+		Vector3 position = Vector3(m_position.m_x + px + 2.0f * (m_rotation.m_w * cx + m_rotation.m_y * cz - m_rotation.m_z * cy),
+			m_position.m_y + py + 2.0f * (m_rotation.m_w * cy + m_rotation.m_z * cx - m_rotation.m_x * cz),
+			m_position.m_z + pz + 2.0f * (m_rotation.m_w * cz + m_rotation.m_x * cy - m_rotation.m_y * cx));
+		Vector3 scaling = Vector3(m_scaling.m_x * other.m_scaling.m_x, m_scaling.m_y * other.m_scaling.m_y, m_scaling.m_z * other.m_scaling.m_z);
+		return Transform(position, m_rotation.Multiply(other.m_rotation), scaling);
 	}
 
 	Matrix4 Transform::GetWorldMatrix() const
 	{
-		if (m_dirty)
-		{
-			m_worldMatrix = Matrix4::TransformationMatrix(m_position, m_rotation, m_scaling);
-			m_dirty = false;
-		}
-
-		return m_worldMatrix;
+		// The rows are the rotated axes, each scaled along its own axis, written out so only the rotation products are taken.
+		float xx = m_rotation.m_x * m_rotation.m_x;
+		float yy = m_rotation.m_y * m_rotation.m_y;
+		float zz = m_rotation.m_z * m_rotation.m_z;
+		float xy = m_rotation.m_x * m_rotation.m_y;
+		float xz = m_rotation.m_x * m_rotation.m_z;
+		float yz = m_rotation.m_y * m_rotation.m_z;
+		float xw = m_rotation.m_x * m_rotation.m_w;
+		float yw = m_rotation.m_y * m_rotation.m_w;
+		float zw = m_rotation.m_z * m_rotation.m_w;
+
+		Matrix4 result = Matrix4();
+		result[0][0] = (1.0f - 2.0f * (yy + zz)) * m_scaling.m_x;
+		result[0][1] = 2.0f * (xy + zw) * m_scaling.m_x;
+		result[0][2] = 2.0f * (xz - yw) * m_scaling.m_x;
+		result[1][0] = 2.0f * (xy - zw) * m_scaling.m_y;
+		result[1][1] = (1.0f - 2.0f * (xx + zz)) * m_scaling.m_y;
+		result[1][2] = 2.0f * (yz + xw) * m_scaling.m_y;
+		result[2][0] = 2.0f * (xz + yw) * m_scaling.m_z;
+		result[2][1] = 2.0f * (yz - xw) * m_scaling.m_z;
+		result[2][2] = (1.0f - 2.0f * (xx + yy)) * m_scaling.m_z;
+		result[3][0] = m_position.m_x;
+		result[3][1] = m_position.m_y;
+		result[3][2] = m_position.m_z;
+		return result;
 	}
 
 	void Transform::SetPosition(const Vector3 &position)
@@ -84,7 +122,7 @@ namespace acid
 		}
 	}
 
-	void Transform::SetRotation(const Vector3 &rotation)
+	void Transform::SetRotation(const Quaternion &rotation)
 	{
 		if (m_rotation != rotation)
 		{
@@ -93,6 +131,16 @@ namespace acid
 		}
 	}
 
+	Vector3 Transform::GetEulerRotation() const
+	{
+		return m_rotation.ToEuler();
+	}
+
+	void Transform::SetEulerRotation(const Vector3 &rotation)
+	{
+		SetRotation(Quaternion(rotation.m_x, rotation.m_y, rotation.m_z));
+	}
+
 	void Transform::SetScaling(const Vector3 &scaling)
 	{
 		if (m_scaling != scaling)
@@ -102,12 +150,6 @@ namespace acid
 		}
 	}
 
-	void Transform::SetDirty(const bool &dirty) const
-	{
-		m_dirty = dirty;
-		m_worldMatrix = Matrix4::TransformationMatrix(m_position, m_rotation, m_scaling);
-	}
-
 	bool Transform::operator==(const Transform &other) const
 	{
 		return m_position == other.m_position && m_rotation == other.m_rotation && m_scaling == other.m_scaling;
@@ -123,6 +165,16 @@ namespace acid
 		return left.Multiply(right);
 	}
 
+	Transform &Transform::operator=(const Transform &other)
+	{
+		// Assigning is a change, a clean transform copied over another still has to be picked up.
+		m_rotation = other.m_rotation;
+		m_position = other.m_position;
+		m_scaling = other.m_scaling;
+		m_dirty = true;
+		return *this;
+	}
+
 	Transform &Transform::operator*=(const Transform &other)
 	{
 		return *this = Multiply(other);
@@ -141,6 +193,7 @@ namespace acid
 
 	Packet &operator>>(Packet &packet, Transform &transform)
 	{
+		transform.m_dirty = true;
 		return packet >> transform.m_position >> transform.m_rotation >> transform.m_scaling;
 	}
 
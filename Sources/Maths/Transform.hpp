@@ -1,8 +1,8 @@
 ﻿#pragma once
 
 #include "Engine/Exports.hpp"
-#include "Scenes/Component.hpp"
 #include "Matrix4.hpp"
+#include "Quaternion.hpp"
 #include "Vector3.hpp"
 
 namespace acid
@@ -11,17 +11,16 @@ namespace acid
 	class Metadata;
 
 	/// <summary>
-	/// Holds position, rotation, and scale components.
+	/// Holds position, rotation, and scale components, the rotation is a unit quaternion so transforms combine without any trigonometry.
+	/// A transform is a plain value, <seealso cref="TransformComponent"/> holds one as a component.
 	/// </summary>
-	class ACID_EXPORT Transform :
-		public Component
+	class ACID_EXPORT Transform
 	{
 	private:
+		Quaternion m_rotation;
 		Vector3 m_position;
-		Vector3 m_rotation;
 		Vector3 m_scaling;
-		mutable Matrix4 m_worldMatrix;
-		mutable bool m_dirty;
+		bool m_dirty;
 	public:
 		static const Transform IDENTITY;
 
@@ -31,13 +30,21 @@ namespace acid
 		/// <param name="position"> The position. </param>
 		/// <param name="rotation"> The rotation. </param>
 		/// <param name="scaling"> The scaling. </param>
-		explicit Transform(const Vector3 &position = Vector3::ZERO, const Vector3 &rotation = Vector3::ZERO, const Vector3 &scaling = Vector3::ONE);
+		explicit Transform(const Vector3 &position = Vector3::ZERO, const Quaternion &rotation = Quaternion::W_ONE, const Vector3 &scaling = Vector3::ONE);
 
 		/// <summary>
 		/// Constructor for Transform.
 		/// </summary>
 		/// <param name="position"> The position. </param>
-		/// <param name="rotation"> The rotation. </param>
+		/// <param name="rotation"> The rotation, as euler angles in degrees. </param>
+		/// <param name="scaling"> The scaling. </param>
+		Transform(const Vector3 &position, const Vector3 &rotation, const Vector3 &scaling = Vector3::ONE);
+
+		/// <summary>
+		/// Constructor for Transform.
+		/// </summary>
+		/// <param name="position"> The position. </param>
+		/// <param name="rotation"> The rotation, as euler angles in degrees. </param>
 		/// <param name="scale"> The scale. </param>
 		Transform(const Vector3 &position, const Vector3 &rotation, const float &scale);
 
@@ -47,38 +54,54 @@ namespace acid
 		/// <param name="source"> Creates this vector out of a transform. </param>
 		Transform(const Transform &source);
 
-		void Start() override;
-
-		void Update() override;
+		void Decode(const Metadata &metadata);
 
-		void Decode(const Metadata &metadata) override;
-
-		void Encode(Metadata &metadata) const override;
+		void Encode(Metadata &metadata) const;
 
 		/// <summary>
-		/// Multiplies this transform with another transform.
+		/// Multiplies this transform with another transform, the other transform is applied first.
 		/// </summary>
 		/// <param name="other"> The other transform. </param>
 		/// <returns> The resultant transform. </returns>
 		Transform Multiply(const Transform &other) const;
 
+		/// <summary>
+		/// Gets the matrix of this transform, the same matrix as <seealso cref="Matrix4#TransformationMatrix"/> with euler angles.
+		/// </summary>
+		/// <returns> The transformation matrix. </returns>
 		Matrix4 GetWorldMatrix() const;
 
 		Vector3 GetPosition() const { return m_position; }
 
 		void SetPosition(const Vector3 &position);
 
-		Vector3 GetRotation() const { return m_rotation; }
+		Quaternion GetRotation() const { return m_rotation; }
+
+		void SetRotation(const Quaternion &rotation);
+
+		/// <summary>
+		/// Gets the rotation as euler angles, for code that works in angles.
+		/// </summary>
+		/// <returns> The rotation, in degrees. </returns>
+		Vector3 GetEulerRotation() const;
 
-		void SetRotation(const Vector3 &rotation);
+		/// <summary>
+		/// Sets the rotation from euler angles, in the order <seealso cref="Matrix4#TransformationMatrix"/> applies them.
+		/// </summary>
+		/// <param name="rotation"> The rotation, in degrees. </param>
+		void SetEulerRotation(const Vector3 &rotation);
 
 		Vector3 GetScaling() const { return m_scaling; }
 
 		void SetScaling(const Vector3 &scaling);
 
+		/// <summary>
+		/// Gets if this transform changed since it was last marked clean, set when it is created, assigned or changed.
+		/// </summary>
+		/// <returns> If the transform changed. </returns>
 		bool IsDirty() const { return m_dirty; }
 
-		void SetDirty(const bool &dirty) const;
+		void SetDirty(const bool &dirty) { m_dirty = dirty; }
 
 		bool operator==(const Transform &other) const;
 
@@ -86,6 +109,8 @@ namespace acid
 
 		ACID_EXPORT friend Transform operator*(const Transform &left, const Transform &right);
 
+		Transform &operator=(const Transform &other);
+
 		Transform &operator*=(const Transform &other);
 
 		ACID_EXPORT friend std::ostream &operator<<(std::ostream &stream, const Transform &transform);
@@ -6,6 +6,7 @@
 #include "Colour.hpp"
 #include "Matrix4.hpp"
 #include "Quaternion.hpp"
+#include "RandomStream.hpp"
 #include "Vector2.hpp"
 #include "Maths.hpp"
 
@@ -102,7 +103,7 @@ namespace acid
 
 	float Vector3::Dot(const Vector3 &other) const
 	{
-		return m_x * other.m_x + m_y * other.m_y;
+		return m_x * other.m_x + m_y * other.m_y + m_z * other.m_z;
 	}
 
 	Vector3 Vector3::Cross(const Vector3 &other) const
@@ -246,12 +247,7 @@ namespace acid
 
 	Vector3 Vector3::RandomUnitVector()
 	{
-		float theta = Maths::Random(0.0f, 1.0f) * 2.0f * PI;
-		float z = Maths::Random(0.0f, 1.0f) * 2.0f - 1.0f;
-		float rootOneMinusZSquared = std::sqrt(1.0f - z * z);
-		float x = rootOneMinusZSquared * std::cos(theta);
-		float y = rootOneMinusZSquared * std::sin(theta);
-		return Vector3(x, y, z);
+		return RandomStream::Get().NextUnitVector();
 	}
 
 	Vector3 Vector3::RandomPointOnCircle(const Vector3 &normal, const float &radius)
@@ -285,30 +281,7 @@ namespace acid
 
 	Vector3 Vector3::RandomUnitVectorWithinCone(const Vector3 &coneDirection, const float &angle)
 	{
-		float cosAngle = std::cos(angle);
-		float theta = Maths::Random(0.0f, 1.0f) * 2.0f * PI;
-		float z = (cosAngle + Maths::Random(0.0f, 1.0f)) * (1.0f - cosAngle);
-		float rootOneMinusZSquared = std::sqrt(1.0f - z * z);
-		float x = rootOneMinusZSquared * std::cos(theta);
-		float y = rootOneMinusZSquared * std::sin(theta);
-
-		Vector4 direction = Vector4(x, y, z, 1.0f);
-
-		if (coneDirection.m_x != 0.0f || coneDirection.m_y != 0.0f || (coneDirection.m_z != 1.0f && coneDirection.m_z != -1.0f))
-		{
-			Vector3 rotateAxis = coneDirection.Cross(Vector3::FRONT);
-			rotateAxis.Normalize();
-			float rotateAngle = std::acos(coneDirection.Dot(Vector3::FRONT));
-			Matrix4 rotationMatrix = Matrix4();
-			rotationMatrix = rotationMatrix.Rotate(-rotateAngle, rotateAxis);
-			direction = rotationMatrix.Transform(direction);
-		}
-		else if (coneDirection.m_z == -1.0f)
-		{
-			direction.m_z *= -1.0f;
-		}
-
-		return Vector3(direction);
+		return RandomStream::Get().NextUnitVectorWithinCone(coneDirection, angle);
 	}
 
 	void Vector3::Decode(const Metadata &metadata)
@@ -327,7 +300,7 @@ namespace acid
 
 	bool Vector3::operator==(const Vector3 &other) const
 	{
-		return m_x == other.m_x && m_y == other.m_x && m_z == other.m_z;
+		return m_x == other.m_x && m_y == other.m_y && m_z == other.m_z;
 	}
 
 	bool Vector3::operator!=(const Vector3 &other) const
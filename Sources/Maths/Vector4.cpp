@@ -1,6 +1,5 @@
 #include "Vector4.hpp"
 
-#include <cassert>
 #include "Network/Packet.hpp"
 #include "Serialized/Metadata.hpp"
 #include "Colour.hpp"
@@ -227,18 +226,6 @@ namespace acid
 		return Negate();
 	}
 
-	const float &Vector4::operator[](const uint32_t &index) const
-	{
-		assert(index < 4);
-		return m_elements[index];
-	}
-
-	float &Vector4::operator[](const uint32_t &index)
-	{
-		assert(index < 4);
-		return m_elements[index];
-	}
-
 	Vector4 operator+(const Vector4 &left, const Vector4 &right)
 	{
 		return left.Add(right);
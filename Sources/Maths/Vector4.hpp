@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cassert>
 #include <ostream>
 #include <string>
 #include "Engine/Exports.hpp"
@@ -12,7 +13,7 @@ namespace acid
 	class Metadata;
 
 	/// <summary>
-	/// Holds a 4-tuple vector.
+	/// Holds a 4-tuple vector, aligned to 16 bytes so it can be loaded as one SIMD register.
 	/// </summary>
 	class ACID_EXPORT Vector4
 	{
@@ -21,7 +22,7 @@ namespace acid
 		{
 			struct
 			{
-				float m_elements[4];
+				alignas(16) float m_elements[4];
 			};
 
 			struct
@@ -228,9 +229,17 @@ namespace acid
 
 		Vector4 operator-() const;
 
-		const float &operator[](const uint32_t &index) const;
+		const float &operator[](const uint32_t &index) const
+		{
+			assert(index < 4);
+			return m_elements[index];
+		}
 
-		float &operator[](const uint32_t &index);
+		float &operator[](const uint32_t &index)
+		{
+			assert(index < 4);
+			return m_elements[index];
+		}
 
 		ACID_EXPORT friend Vector4 operator+(const Vector4 &left, const Vector4 &right);
 
@@ -0,0 +1,47 @@
+#include "BlockPool.hpp"
+
+#include <new>
+
+namespace acid
+{
+	const std::size_t BlockPool::ALIGNMENT = 16;
+
+	BlockPool::BlockPool(const std::size_t &blockSize, const std::size_t &chunkBlocks) :
+		m_mutex(std::mutex()),
+		m_blockSize(((blockSize - 1) / ALIGNMENT + 1) * ALIGNMENT),
+		m_chunkBlocks(chunkBlocks),
+		m_free(nullptr),
+		m_next(nullptr),
+		m_end(nullptr)
+	{
+	}
+
+	void *BlockPool::Allocate()
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+
+		if (m_free != nullptr)
+		{
+			auto block = m_free;
+			m_free = *static_cast<void **>(block);
+			return block;
+		}
+
+		if (m_next == m_end)
+		{
+			m_next = static_cast<uint8_t *>(::operator new(m_blockSize * m_chunkBlocks));
+			m_end = m_next + m_blockSize * m_chunkBlocks;
+		}
+
+		auto block = m_next;
+		m_next += m_blockSize;
+		return block;
+	}
+
+	void BlockPool::Deallocate(void *block)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		*static_cast<void **>(block) = m_free;
+		m_free = block;
+	}
+}
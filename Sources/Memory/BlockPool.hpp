@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A allocator of same sized blocks, taken from chunks that are never freed. Released blocks are reused first,
+	/// so objects created together sit next to each other in memory and creating and destroying many of them does not fragment the heap.
+	/// </summary>
+	class ACID_EXPORT BlockPool
+	{
+	private:
+		std::mutex m_mutex;
+		std::size_t m_blockSize;
+		std::size_t m_chunkBlocks;
+		void *m_free;
+		uint8_t *m_next;
+		uint8_t *m_end;
+	public:
+		/// <summary>
+		/// The alignment of every block, block sizes are rounded up to it.
+		/// </summary>
+		static const std::size_t ALIGNMENT;
+
+		/// <summary>
+		/// Creates a new block pool.
+		/// </summary>
+		/// <param name="blockSize"> The size of each block. </param>
+		/// <param name="chunkBlocks"> The amount of blocks taken from the heap at once. </param>
+		explicit BlockPool(const std::size_t &blockSize, const std::size_t &chunkBlocks = 64);
+
+		BlockPool(const BlockPool&) = delete;
+
+		BlockPool& operator=(const BlockPool&) = delete;
+
+		/// <summary>
+		/// Takes a block from the pool.
+		/// </summary>
+		/// <returns> The block. </returns>
+		void *Allocate();
+
+		/// <summary>
+		/// Gives a block back to the pool.
+		/// </summary>
+		/// <param name="block"> The block, taken from this pool. </param>
+		void Deallocate(void *block);
+
+		/// <summary>
+		/// Gets the size of each block.
+		/// </summary>
+		/// <returns> The block size. </returns>
+		std::size_t GetBlockSize() const { return m_blockSize; }
+	};
+}
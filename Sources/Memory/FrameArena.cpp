@@ -0,0 +1,161 @@
+#include "FrameArena.hpp"
+
+#include <algorithm>
+#include "Engine/Profiler.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// The blocks of one thread, split into a buffer for even and a buffer for odd frames.
+	/// </summary>
+	class FrameArena::Arena
+	{
+	public:
+		struct Block
+		{
+			std::unique_ptr<uint8_t[]> m_data;
+			std::size_t m_size;
+		};
+
+		struct Buffer
+		{
+			std::vector<Block> m_blocks;
+			std::size_t m_block;
+			std::size_t m_offset;
+			uint64_t m_frame;
+		};
+
+		Buffer m_buffers[2];
+		// Totals are only written by the owning thread, the frame end reads them and keeps what it has seen.
+		std::atomic<uint64_t> m_allocations;
+		std::atomic<uint64_t> m_bytes;
+		std::atomic<uint64_t> m_reserved;
+		uint64_t m_seenAllocations;
+		uint64_t m_seenBytes;
+
+		Arena() :
+			m_buffers{{{}, 0, 0, 0}, {{}, 0, 0, 0}},
+			m_allocations(0),
+			m_bytes(0),
+			m_reserved(0),
+			m_seenAllocations(0),
+			m_seenBytes(0)
+		{
+		}
+
+		static void Add(std::atomic<uint64_t> &total, const uint64_t &value)
+		{
+			total.store(total.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+		}
+	};
+
+	const std::size_t FrameArena::BLOCK_SIZE = 1024 * 1024;
+
+	std::atomic<uint64_t> FrameArena::FRAME = 0;
+	std::mutex FrameArena::MUTEX = std::mutex();
+	std::vector<std::unique_ptr<FrameArena::Arena>> FrameArena::ARENAS = std::vector<std::unique_ptr<FrameArena::Arena>>();
+	uint64_t FrameArena::ALLOCATIONS = 0;
+	uint64_t FrameArena::BYTES = 0;
+	uint64_t FrameArena::RESERVED = 0;
+
+	void *FrameArena::Allocate(const std::size_t &size, const std::size_t &alignment)
+	{
+		auto arena = GetArena();
+		uint64_t frame = FRAME.load(std::memory_order_acquire);
+		auto &buffer = arena->m_buffers[frame % 2];
+
+		// The first allocation in a new frame rewinds the buffer, blocks are kept for reuse.
+		if (buffer.m_frame != frame)
+		{
+			buffer.m_frame = frame;
+			buffer.m_block = 0;
+			buffer.m_offset = 0;
+		}
+
+		Arena::Add(arena->m_allocations, 1);
+		Arena::Add(arena->m_bytes, size);
+
+		while (true)
+		{
+			if (buffer.m_block >= buffer.m_blocks.size())
+			{
+				auto blockSize = std::max(BLOCK_SIZE, size + alignment);
+				buffer.m_blocks.push_back({std::make_unique<uint8_t[]>(blockSize), blockSize});
+				Arena::Add(arena->m_reserved, blockSize);
+			}
+
+			auto &block = buffer.m_blocks[buffer.m_block];
+			auto start = reinterpret_cast<uintptr_t>(block.m_data.get());
+			auto aligned = (start + buffer.m_offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+
+			if (aligned + size <= start + block.m_size)
+			{
+				buffer.m_offset = aligned + size - start;
+				return reinterpret_cast<void *>(aligned);
+			}
+
+			buffer.m_block++;
+			buffer.m_offset = 0;
+		}
+	}
+
+	void FrameArena::EndFrame()
+	{
+		{
+			std::lock_guard<std::mutex> lock(MUTEX);
+			ALLOCATIONS = 0;
+			BYTES = 0;
+			RESERVED = 0;
+
+			for (auto &arena : ARENAS)
+			{
+				auto allocations = arena->m_allocations.load(std::memory_order_relaxed);
+				auto bytes = arena->m_bytes.load(std::memory_order_relaxed);
+				ALLOCATIONS += allocations - arena->m_seenAllocations;
+				BYTES += bytes - arena->m_seenBytes;
+				RESERVED += arena->m_reserved.load(std::memory_order_relaxed);
+				arena->m_seenAllocations = allocations;
+				arena->m_seenBytes = bytes;
+			}
+
+			FRAME.fetch_add(1, std::memory_order_release);
+		}
+
+		ACID_PROFILE_COUNTER("FrameArena Allocations", static_cast<int64_t>(GetAllocations()));
+		ACID_PROFILE_COUNTER("FrameArena Bytes", static_cast<int64_t>(GetBytes()));
+		ACID_PROFILE_COUNTER("FrameArena Reserved", static_cast<int64_t>(GetReserved()));
+	}
+
+	uint64_t FrameArena::GetAllocations()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return ALLOCATIONS;
+	}
+
+	uint64_t FrameArena::GetBytes()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return BYTES;
+	}
+
+	uint64_t FrameArena::GetReserved()
+	{
+		std::lock_guard<std::mutex> lock(MUTEX);
+		return RESERVED;
+	}
+
+	FrameArena::Arena *FrameArena::GetArena()
+	{
+		static thread_local Arena *arena = nullptr;
+
+		if (arena == nullptr)
+		{
+			// Arenas are kept until exit, memory handed out by a finished thread may still be in use.
+			std::lock_guard<std::mutex> lock(MUTEX);
+			ARENAS.emplace_back(std::make_unique<Arena>());
+			arena = ARENAS.back().get();
+		}
+
+		return arena;
+	}
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A linear allocator for data that only lives for a frame. Every thread allocates from its own arena without locking,
+	/// arenas are double buffered so memory allocated during a frame stays valid until the end of the next frame, this lets a pipelined render read it.
+	/// Freeing memory does nothing, the arena of a thread is reset in O(1) the first time it allocates in a new frame.
+	/// </summary>
+	class ACID_EXPORT FrameArena
+	{
+	private:
+		class Arena;
+
+		static std::atomic<uint64_t> FRAME;
+		static std::mutex MUTEX;
+		static std::vector<std::unique_ptr<Arena>> ARENAS;
+		static uint64_t ALLOCATIONS;
+		static uint64_t BYTES;
+		static uint64_t RESERVED;
+	public:
+		/// <summary>
+		/// The size of the blocks arenas take from the heap, larger allocations get a block of their own.
+		/// </summary>
+		static const std::size_t BLOCK_SIZE;
+
+		/// <summary>
+		/// Allocates memory from the calling threads arena.
+		/// </summary>
+		/// <param name="size"> The size in bytes. </param>
+		/// <param name="alignment"> The alignment in bytes, must be a power of two. </param>
+		/// <returns> The allocated memory, valid until the end of the next frame. </returns>
+		static void *Allocate(const std::size_t &size, const std::size_t &alignment = alignof(std::max_align_t));
+
+		/// <summary>
+		/// Ends the current frame, the memory of the frame before it can then be reused. Called once a frame by the engine.
+		/// </summary>
+		static void EndFrame();
+
+		/// <summary>
+		/// Gets the current frame index.
+		/// </summary>
+		/// <returns> The frame index. </returns>
+		static uint64_t GetFrame() { return FRAME.load(std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Gets the amount of allocations made during the last frame.
+		/// </summary>
+		/// <returns> The allocation count. </returns>
+		static uint64_t GetAllocations();
+
+		/// <summary>
+		/// Gets the amount of bytes allocated during the last frame.
+		/// </summary>
+		/// <returns> The allocated bytes. </returns>
+		static uint64_t GetBytes();
+
+		/// <summary>
+		/// Gets the amount of heap memory held by every threads arena.
+		/// </summary>
+		/// <returns> The reserved bytes. </returns>
+		static uint64_t GetReserved();
+	private:
+		static Arena *GetArena();
+	};
+
+	/// <summary>
+	/// A STL allocator that allocates from the <seealso cref="FrameArena"/>, containers using it must not be kept past the end of the next frame.
+	/// </summary>
+	/// <param name="T"> The type being allocated. </param>
+	template<typename T>
+	class FrameAllocator
+	{
+	public:
+		using value_type = T;
+
+		FrameAllocator() noexcept = default;
+
+		template<typename U>
+		FrameAllocator(const FrameAllocator<U> &) noexcept
+		{
+		}
+
+		T *allocate(const std::size_t &n)
+		{
+			return static_cast<T *>(FrameArena::Allocate(n * sizeof(T), alignof(T)));
+		}
+
+		void deallocate(T *, const std::size_t &) noexcept
+		{
+		}
+
+		template<typename U>
+		bool operator==(const FrameAllocator<U> &) const noexcept { return true; }
+
+		template<typename U>
+		bool operator!=(const FrameAllocator<U> &) const noexcept { return false; }
+	};
+
+	/// <summary>
+	/// A vector allocated from the <seealso cref="FrameArena"/>.
+	/// </summary>
+	template<typename T>
+	using FrameVector = std::vector<T, FrameAllocator<T>>;
+}
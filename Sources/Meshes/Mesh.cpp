@@ -1,5 +1,7 @@
 #include "Mesh.hpp"
 
+#include "Scenes/Entity.hpp"
+
 namespace acid
 {
 	Mesh::Mesh(const std::shared_ptr<Model> &model) :
@@ -11,10 +13,6 @@ namespace acid
 	{
 	}
 
-	void Mesh::Update()
-	{
-	}
-
 	void Mesh::Decode(const Metadata &metadata)
 	{
 		TrySetModel(metadata.GetChild<std::string>("Model"));
@@ -25,8 +23,37 @@ namespace acid
 		metadata.SetChild<std::string>("Model", m_model == nullptr ? "" : m_model->GetName());
 	}
 
+	std::optional<Aabb> Mesh::GetBounds() const
+	{
+		auto model = GetModel();
+
+		if (model == nullptr || GetParent() == nullptr)
+		{
+			return {};
+		}
+
+		Aabb bounds = Aabb(model->GetMinExtents(), model->GetMaxExtents());
+
+		if (bounds.IsEmpty())
+		{
+			return {};
+		}
+
+		return bounds.Transform(GetParent()->GetWorldMatrix());
+	}
+
+	void Mesh::SetModel(const std::shared_ptr<Model> &model)
+	{
+		m_model = model;
+
+		if (GetParent() != nullptr)
+		{
+			GetParent()->SetBoundsDirty();
+		}
+	}
+
 	void Mesh::TrySetModel(const std::string &filename)
 	{
-		m_model = Model::Create(filename);
+		SetModel(Model::Create(filename));
 	}
 }
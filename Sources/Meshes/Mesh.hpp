@@ -25,17 +25,17 @@ namespace acid
 
 		void Start() override;
 
-		void Update() override;
-
 		void Decode(const Metadata &metadata) override;
 
 		void Encode(Metadata &metadata) const override;
 
+		std::optional<Aabb> GetBounds() const override;
+
 		virtual std::shared_ptr<Model> GetModel() const { return m_model; }
 
 		virtual VertexInput GetVertexInput(const uint32_t &binding = 0) const { return VertexModel::GetVertexInput(binding); }
 
-		virtual void SetModel(const std::shared_ptr<Model> &model) { m_model = model; }
+		virtual void SetModel(const std::shared_ptr<Model> &model);
 
 		virtual void TrySetModel(const std::string &filename); // TODO: Remove
 	};
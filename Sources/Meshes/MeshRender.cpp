@@ -1,15 +1,18 @@
 #include "MeshRender.hpp"
 
 #include "Materials/Material.hpp"
-#include "Physics/Rigidbody.hpp"
 #include "Scenes/Entity.hpp"
-#include "Scenes/Scenes.hpp"
+#include "Scenes/Camera.hpp"
 
 namespace acid
 {
 	MeshRender::MeshRender() :
 		m_descriptorSet(DescriptorsHandler()),
-		m_uniformObject(UniformHandler())
+		m_uniformObject(UniformHandler()),
+		m_material(nullptr),
+		m_materialPipeline(nullptr),
+		m_model(nullptr),
+		m_cameraDistance(0.0f)
 	{
 	}
 
@@ -17,63 +20,52 @@ namespace acid
 	{
 	}
 
-	void MeshRender::Update()
+	bool MeshRender::Capture(const Camera &camera)
 	{
-		auto material = GetParent()->GetComponent<Material>();
-
-		if (material == nullptr)
-		{
-			return;
-		}
-
-		// Updates uniforms.
-		material->PushUniforms(m_uniformObject);
-	}
-
-	bool MeshRender::CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene, const GraphicsStage &graphicsStage)
-	{
-		// Checks if the mesh is in view.
-		auto rigidbody = GetParent()->GetComponent<Rigidbody>();
+		// Gets required components.
+		m_material = GetParent()->GetComponent<Material>();
+		auto mesh = GetParent()->GetComponent<Mesh>();
 
-		if (rigidbody != nullptr)
+		if (m_material == nullptr || mesh == nullptr)
 		{
-			if (!rigidbody->InFrustum(Scenes::Get()->GetCamera()->GetViewFrustum()))
-			{
-				return false;
-			}
+			return false;
 		}
 
-		// Gets required components.
-		auto material = GetParent()->GetComponent<Material>();
-		auto mesh = GetParent()->GetComponent<Mesh>();
+		m_model = mesh->GetModel();
+		m_materialPipeline = m_material->GetMaterialPipeline();
 
-		if (material == nullptr || mesh == nullptr)
+		if (m_model == nullptr || m_materialPipeline == nullptr)
 		{
 			return false;
 		}
 
-		auto meshModel = mesh->GetModel();
-		auto materialPipeline = material->GetMaterialPipeline();
+		// Updates uniforms, the recorded frame reads these until the next capture.
+		m_material->PushUniforms(m_uniformObject);
+		m_cameraDistance = (camera.GetPosition() - GetParent()->GetWorldTransform().GetPosition()).LengthSquared();
+		return true;
+	}
 
-		if (meshModel == nullptr || materialPipeline->GetGraphicsStage() != graphicsStage)
+	bool MeshRender::CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene, const GraphicsStage &graphicsStage)
+	{
+		if (m_materialPipeline == nullptr || m_materialPipeline->GetGraphicsStage() != graphicsStage)
 		{
 			return false;
 		}
 
 		// Binds the material pipeline.
-		bool bindSuccess = materialPipeline->BindPipeline(commandBuffer);
+		bool bindSuccess = m_materialPipeline->BindPipeline(commandBuffer);
 
 		if (!bindSuccess)
 		{
 			return false;
 		}
 
-		auto &pipeline = *materialPipeline->GetPipeline();
+		auto &pipeline = *m_materialPipeline->GetPipeline();
 
 		// Updates descriptors.
 		m_descriptorSet.Push("UboScene", uniformScene);
 		m_descriptorSet.Push("UboObject", m_uniformObject);
-		material->PushDescriptors(m_descriptorSet);
+		m_material->PushDescriptors(m_descriptorSet);
 		bool updateSuccess = m_descriptorSet.Update(pipeline);
 
 		if (!updateSuccess)
@@ -83,7 +75,7 @@ namespace acid
 
 		// Draws the object.
 		m_descriptorSet.BindDescriptor(commandBuffer, pipeline);
-		meshModel->CmdRender(commandBuffer);
+		m_model->CmdRender(commandBuffer);
 		return true;
 	}
 
@@ -97,11 +89,6 @@ namespace acid
 
 	bool MeshRender::operator<(const MeshRender &other) const
 	{
-		auto camera = Scenes::Get()->GetCamera();
-
-		float thisDistance2 = (camera->GetPosition() - GetParent()->GetWorldTransform().GetPosition()).LengthSquared();
-		float otherDistance2 = (camera->GetPosition() - other.GetParent()->GetWorldTransform().GetPosition()).LengthSquared();
-
-		return thisDistance2 > otherDistance2;
+		return m_cameraDistance > other.m_cameraDistance;
 	}
 }
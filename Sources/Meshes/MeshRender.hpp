@@ -6,25 +6,48 @@
 
 namespace acid
 {
+	class Camera;
+	class Material;
+	class PipelineMaterial;
+
 	class ACID_EXPORT MeshRender :
 		public Component
 	{
 	private:
 		DescriptorsHandler m_descriptorSet;
 		UniformHandler m_uniformObject;
+
+		Material *m_material;
+		std::shared_ptr<PipelineMaterial> m_materialPipeline;
+		std::shared_ptr<Model> m_model;
+		float m_cameraDistance;
 	public:
 		MeshRender();
 
 		void Start() override;
 
-		void Update() override;
-
 		void Decode(const Metadata &metadata) override;
 
 		void Encode(Metadata &metadata) const override;
 
+		/// <summary>
+		/// Copies the state needed to render this mesh, called between updates when no frame is being recorded.
+		/// </summary>
+		/// <param name="camera"> The camera the frame will be rendered from. </param>
+		/// <returns> If the mesh can be rendered, it is culled against the camera before this is called. </returns>
+		bool Capture(const Camera &camera);
+
+		/// <summary>
+		/// Records the mesh using the state from the last <seealso cref="#Capture()"/>.
+		/// </summary>
 		bool CmdRender(const CommandBuffer &commandBuffer, UniformHandler &uniformScene, const GraphicsStage &graphicsStage);
 
+		/// <summary>
+		/// Gets the squared distance from the camera when last captured.
+		/// </summary>
+		/// <returns> The squared camera distance. </returns>
+		float GetCameraDistance() const { return m_cameraDistance; }
+
 		bool operator<(const MeshRender &other) const;
 	};
 }
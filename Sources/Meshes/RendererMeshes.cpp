@@ -1,6 +1,6 @@
 ﻿#include "RendererMeshes.hpp"
 
-#include "Scenes/Scenes.hpp"
+#include "Renderer/Renderer.hpp"
 #include "MeshRender.hpp"
 
 namespace acid
@@ -18,19 +18,20 @@ namespace acid
 		m_uniformScene.Push("view", camera.GetViewMatrix());
 		m_uniformScene.Push("cameraPos", camera.GetPosition());
 
-		auto sceneMeshRenders = Scenes::Get()->GetStructure()->QueryComponents<MeshRender>();
+		auto &meshRenders = Renderer::Get()->GetSnapshot().GetMeshRenders();
 
-		if (m_meshSort != MESH_SORT_NONE)
+		// The snapshot is sorted front to back, back to front is drawn in reverse.
+		if (m_meshSort == MESH_SORT_BACK)
 		{
-			std::sort(sceneMeshRenders.begin(), sceneMeshRenders.end());
-
-			if (m_meshSort == MESH_SORT_FRONT)
+			for (auto it = meshRenders.rbegin(); it != meshRenders.rend(); ++it)
 			{
-				std::reverse(sceneMeshRenders.begin(), sceneMeshRenders.end());
+				(*it)->CmdRender(commandBuffer, m_uniformScene, GetGraphicsStage());
 			}
+
+			return;
 		}
 
-		for (auto &meshRender : sceneMeshRenders)
+		for (auto &meshRender : meshRenders)
 		{
 			meshRender->CmdRender(commandBuffer, m_uniformScene, GetGraphicsStage());
 		}
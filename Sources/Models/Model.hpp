@@ -3,10 +3,11 @@
 #include <cmath>
 #include <string>
 #include <vector>
+#include "Engine/Engine.hpp"
 #include "Maths/Vector3.hpp"
 #include "Renderer/Buffers/IndexBuffer.hpp"
 #include "Renderer/Buffers/VertexBuffer.hpp"
-#include "Resources/Resource.hpp"
+#include "Resources/Resources.hpp"
 #include "IVertex.hpp"
 
 namespace acid
@@ -71,12 +72,13 @@ namespace acid
 			static_assert(std::is_base_of<IVertex, T>::value, "T must derive from IVertex!");
 			m_name = name;
 
-			if (!vertices.empty())
+			// A headless engine has no device to upload into, only the bounds are calculated.
+			if (!vertices.empty() && Resources::HasDevice())
 			{
 				m_vertexBuffer = std::make_unique<VertexBuffer>(sizeof(T), vertices.size(), vertices.data());
 			}
 
-			if (!indices.empty())
+			if (!indices.empty() && Resources::HasDevice())
 			{
 				m_indexBuffer = std::make_unique<IndexBuffer>(VK_INDEX_TYPE_UINT32, sizeof(uint32_t), indices.size(), indices.data());
 			}
@@ -88,7 +90,7 @@ namespace acid
 			{
 				Vector3 position = vertex.GetPosition();
 				m_minExtents = Vector3::MinVector(m_minExtents, position);
-				m_maxExtents = Vector3::MinVector(m_maxExtents, position);
+				m_maxExtents = Vector3::MaxVector(m_maxExtents, position);
 			}
 
 			float min0 = std::abs(m_minExtents.MaxComponent());
@@ -1,6 +1,7 @@
 #include "ModelObj.hpp"
 
 #include <cassert>
+#include "Engine/Profiler.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Resources/Resources.hpp"
 
@@ -30,6 +31,8 @@ namespace acid
 	ModelObj::ModelObj(const std::string &filename) :
 		Model()
 	{
+		ACID_PROFILE_SCOPE("ModelObj::Load");
+
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
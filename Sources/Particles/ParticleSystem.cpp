@@ -1,6 +1,7 @@
 ﻿#include "ParticleSystem.hpp"
 
 #include "Maths/Maths.hpp"
+#include "Maths/RandomStream.hpp"
 #include "Particles.hpp"
 
 namespace acid
@@ -44,9 +45,11 @@ namespace acid
 				return;
 			}
 
+			auto &random = RandomStream::Get();
+
 			for (uint32_t i = 0; i < pastFactor; i++)
 			{
-				Particles::Get()->AddParticle(EmitParticle(*emitters[static_cast<uint32_t>(Maths::Random(0, emitters.size()))]));
+				Particles::Get()->AddParticle(EmitParticle(*emitters[random.NextIndex(static_cast<uint32_t>(emitters.size()))]));
 			}
 		}
 	}
@@ -145,21 +148,22 @@ namespace acid
 		auto worldTransform = GetParent()->GetWorldTransform() * emitter.GetLocalTransform();
 		Vector3 spawnPos = emitter.GeneratePosition() + worldTransform.GetPosition();
 
+		// The stream is fetched once, every value for the particle comes from the calling thread without locking.
+		auto &random = RandomStream::Get();
 		Vector3 velocity;
 
 		if (m_direction != 0.0f)
 		{
-			velocity = Vector3::RandomUnitVectorWithinCone(m_direction, m_directionDeviation);
+			velocity = random.NextUnitVectorWithinCone(m_direction, m_directionDeviation);
 		}
 		else
 		{
-			velocity = GenerateRandomUnitVector();
+			velocity = random.NextUnitVector();
 		}
 
-		velocity = velocity.Normalize();
 		velocity *= GenerateValue(m_averageSpeed, m_speedDeviation);
 
-		auto emitType = m_types.at(static_cast<uint32_t>(std::floor(Maths::Random(0.0f, static_cast<float>(m_types.size())))));
+		auto emitType = m_types.at(random.NextIndex(static_cast<uint32_t>(m_types.size())));
 		float scale = GenerateValue(emitType->GetScale(), m_scaleDeviation);
 		float lifeLength = GenerateValue(emitType->GetLifeLength(), m_lifeDeviation);
 		float stageCycles = GenerateValue(emitType->GetStageCycles(), m_stageDeviation);
@@ -168,7 +172,7 @@ namespace acid
 
 	float ParticleSystem::GenerateValue(const float &average, const float &errorPercent) const
 	{
-		float error = Maths::Random(-1.0f, 1.0f) * errorPercent;
+		float error = RandomStream::Get().Next(-1.0f, 1.0f) * errorPercent;
 		return average + (average * error);
 	}
 
@@ -176,19 +180,9 @@ namespace acid
 	{
 		if (m_randomRotation)
 		{
-			return Maths::Random(0.0f, 360.0f);
+			return RandomStream::Get().Next(0.0f, 360.0f);
 		}
 
 		return 0.0f;
 	}
-
-	Vector3 ParticleSystem::GenerateRandomUnitVector() const
-	{
-		float theta = Maths::Random(0.0f, 1.0f) * 2.0f * PI;
-		float z = Maths::Random(0.0f, 1.0f) * 2.0f - 1.0f;
-		float rootOneMinusZSquared = std::sqrt(1.0f - z * z);
-		float x = rootOneMinusZSquared * std::cos(theta);
-		float y = rootOneMinusZSquared * std::sin(theta);
-		return Vector3(x, y, z);
-	}
 }
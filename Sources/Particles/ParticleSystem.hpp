@@ -97,7 +97,5 @@ namespace acid
 		float GenerateValue(const float &average, const float &errorPercent) const;
 
 		float GenerateRotation() const;
-
-		Vector3 GenerateRandomUnitVector() const;
 	};
 }
@@ -3,6 +3,7 @@
 #include "Resources/Resources.hpp"
 #include "Models/Shapes/ModelRectangle.hpp"
 #include "Helpers/String.hpp"
+#include "Memory/FrameArena.hpp"
 #include "Scenes/Scenes.hpp"
 #include "Particle.hpp"
 
@@ -40,7 +41,7 @@ namespace acid
 	ParticleType::ParticleType(const std::shared_ptr<Texture> &texture, const uint32_t &numberOfRows, const Colour &colourOffset, const float &lifeLength, const float &stageCycles, const float &scale) :
 		Resource(ToName(texture, numberOfRows, colourOffset, lifeLength, stageCycles, scale)),
 		m_texture(texture),
-		m_model(ModelRectangle::Create(-0.5f, 0.5f)),
+		m_model(nullptr),
 		m_numberOfRows(numberOfRows),
 		m_colourOffset(colourOffset),
 		m_lifeLength(lifeLength),
@@ -51,6 +52,11 @@ namespace acid
 		m_descriptorSet(DescriptorsHandler()),
 		m_storageInstances(StorageHandler())
 	{
+		// A headless engine never renders particles, so no GPU model is created.
+		if (!Engine::Get()->IsHeadless())
+		{
+			m_model = ModelRectangle::Create(-0.5f, 0.5f);
+		}
 	}
 
 	void ParticleType::Update(const std::vector<Particle> &particles)
@@ -58,17 +64,30 @@ namespace acid
 		// Calculates a max instance count over the time of the type. TODO: Allow decreasing max using a timer and average count over the delay.
 		uint32_t instances = INSTANCE_STEPS * static_cast<uint32_t>(std::ceil(static_cast<float>(particles.size()) / static_cast<float>(INSTANCE_STEPS)));
 		m_maxInstances = std::max(m_maxInstances, instances);
-		std::vector<ParticleData> instanceDatas(m_maxInstances);
+		FrameVector<ParticleData> instanceDatas(m_maxInstances);
 		m_instances = 0;
 
-		for (auto &particle : particles)
+		// Every particle is culled in one call before any instance data is written.
+		FrameVector<Vector3> centres(particles.size());
+		FrameVector<float> radii(particles.size());
+		FrameVector<uint32_t> visible(Frustum::GetMaskWords(particles.size()));
+
+		for (std::size_t i = 0; i < particles.size(); i++)
+		{
+			centres[i] = particles[i].GetPosition();
+			radii[i] = FRUSTUM_BUFFER * particles[i].GetScale();
+		}
+
+		Scenes::Get()->GetCamera()->GetViewFrustum().CullSpheres(centres.data(), radii.data(), particles.size(), visible.data());
+
+		for (std::size_t i = 0; i < particles.size(); i++)
 		{
-			if (!Scenes::Get()->GetCamera()->GetViewFrustum().SphereInFrustum(particle.GetPosition(), FRUSTUM_BUFFER * particle.GetScale()))
+			if (!Frustum::IsVisible(visible.data(), i))
 			{
 				continue;
 			}
 
-			instanceDatas[m_instances] = GetInstanceData(particle);
+			instanceDatas[m_instances] = GetInstanceData(particles[i]);
 			m_instances++;
 
 			if (m_instances >= m_maxInstances)
@@ -8,6 +8,8 @@ namespace acid
 		m_mutex(std::mutex()),
 		m_particles(std::map<std::shared_ptr<ParticleType>, std::vector<Particle>>())
 	{
+		Reads<Scenes>();
+		Writes<Particles>();
 	}
 
 	void Particles::Update()
@@ -18,6 +20,7 @@ namespace acid
 		}
 
 		std::lock_guard<std::mutex> lock(m_mutex);
+		bool headless = Engine::Get()->IsHeadless();
 
 		for (auto it = m_particles.begin(); it != m_particles.end();)
 		{
@@ -40,8 +43,13 @@ namespace acid
 				continue;
 			}
 
-			std::sort((*it).second.begin(), (*it).second.end());
-			(*it).first->Update((*it).second);
+			// Sorting and instance data are only used for rendering, a headless engine only simulates the particles.
+			if (!headless)
+			{
+				std::sort((*it).second.begin(), (*it).second.end());
+				(*it).first->Update((*it).second);
+			}
+
 			++it;
 		}
 	}
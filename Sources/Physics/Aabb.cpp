@@ -0,0 +1,112 @@
+#include "Aabb.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace acid
+{
+	Aabb::Aabb() :
+		m_min(Vector3::POSITIVE_INFINITY),
+		m_max(Vector3::NEGATIVE_INFINITY)
+	{
+	}
+
+	Aabb::Aabb(const Vector3 &min, const Vector3 &max) :
+		m_min(min),
+		m_max(max)
+	{
+	}
+
+	bool Aabb::IsEmpty() const
+	{
+		return m_min.m_x > m_max.m_x || m_min.m_y > m_max.m_y || m_min.m_z > m_max.m_z;
+	}
+
+	float Aabb::GetSurfaceArea() const
+	{
+		Vector3 size = m_max - m_min;
+		return 2.0f * (size.m_x * size.m_y + size.m_y * size.m_z + size.m_z * size.m_x);
+	}
+
+	Aabb Aabb::Union(const Aabb &other) const
+	{
+		return Aabb(Vector3::MinVector(m_min, other.m_min), Vector3::MaxVector(m_max, other.m_max));
+	}
+
+	Aabb Aabb::Union(const Vector3 &point) const
+	{
+		return Aabb(Vector3::MinVector(m_min, point), Vector3::MaxVector(m_max, point));
+	}
+
+	Aabb Aabb::Expand(const float &margin) const
+	{
+		return Aabb(m_min - margin, m_max + margin);
+	}
+
+	Aabb Aabb::Transform(const Matrix4 &matrix) const
+	{
+		// The new extents are the absolute rotation and scale applied to the old extents, so no corners have to be transformed.
+		Vector3 centre = GetCentre();
+		Vector3 extents = GetExtents();
+		Vector3 newCentre = Vector3(matrix.m_rows[3].m_x, matrix.m_rows[3].m_y, matrix.m_rows[3].m_z);
+		Vector3 newExtents = Vector3();
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			for (uint32_t j = 0; j < 3; j++)
+			{
+				newCentre[j] += matrix.m_rows[i][j] * centre[i];
+				newExtents[j] += std::abs(matrix.m_rows[i][j]) * extents[i];
+			}
+		}
+
+		return Aabb(newCentre - newExtents, newCentre + newExtents);
+	}
+
+	bool Aabb::Contains(const Aabb &other) const
+	{
+		return m_min.m_x <= other.m_min.m_x && m_min.m_y <= other.m_min.m_y && m_min.m_z <= other.m_min.m_z &&
+			m_max.m_x >= other.m_max.m_x && m_max.m_y >= other.m_max.m_y && m_max.m_z >= other.m_max.m_z;
+	}
+
+	bool Aabb::Intersects(const Aabb &other) const
+	{
+		return m_min.m_x <= other.m_max.m_x && m_max.m_x >= other.m_min.m_x &&
+			m_min.m_y <= other.m_max.m_y && m_max.m_y >= other.m_min.m_y &&
+			m_min.m_z <= other.m_max.m_z && m_max.m_z >= other.m_min.m_z;
+	}
+
+	bool Aabb::Intersects(const Vector3 &centre, const float &radius) const
+	{
+		Vector3 closest = Vector3::MaxVector(m_min, Vector3::MinVector(centre, m_max));
+		return (closest - centre).LengthSquared() <= radius * radius;
+	}
+
+	std::optional<float> Aabb::Intersects(const Vector3 &origin, const Vector3 &inverseDirection, const float &distance) const
+	{
+		float enter = 0.0f;
+		float exit = distance;
+
+		for (uint32_t i = 0; i < 3; i++)
+		{
+			float slabMin = (m_min[i] - origin[i]) * inverseDirection[i];
+			float slabMax = (m_max[i] - origin[i]) * inverseDirection[i];
+
+			if (slabMin > slabMax)
+			{
+				std::swap(slabMin, slabMax);
+			}
+
+			// A axis parallel ray starting on a slab gives NaN, the comparisons are written so it is ignored.
+			enter = slabMin > enter ? slabMin : enter;
+			exit = slabMax < exit ? slabMax : exit;
+
+			if (enter > exit)
+			{
+				return {};
+			}
+		}
+
+		return enter;
+	}
+}
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <optional>
+#include "Maths/Matrix4.hpp"
+#include "Maths/Vector3.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A axis aligned bounding box.
+	/// </summary>
+	class ACID_EXPORT Aabb
+	{
+	public:
+		Vector3 m_min;
+		Vector3 m_max;
+
+		/// <summary>
+		/// Creates a new empty bounding box, it contains nothing until points are added.
+		/// </summary>
+		Aabb();
+
+		/// <summary>
+		/// Creates a new bounding box.
+		/// </summary>
+		/// <param name="min"> The minimum corner. </param>
+		/// <param name="max"> The maximum corner. </param>
+		Aabb(const Vector3 &min, const Vector3 &max);
+
+		/// <summary>
+		/// Gets if the box contains anything, a empty box has its minimum above its maximum.
+		/// </summary>
+		/// <returns> If the box is empty. </returns>
+		bool IsEmpty() const;
+
+		Vector3 GetCentre() const { return (m_min + m_max) * 0.5f; }
+
+		Vector3 GetExtents() const { return (m_max - m_min) * 0.5f; }
+
+		/// <summary>
+		/// Gets the surface area of the box, used to estimate the cost of a tree node.
+		/// </summary>
+		/// <returns> The surface area. </returns>
+		float GetSurfaceArea() const;
+
+		/// <summary>
+		/// Gets the smallest box containing this box and another.
+		/// </summary>
+		/// <param name="other"> The other box. </param>
+		/// <returns> The combined box. </returns>
+		Aabb Union(const Aabb &other) const;
+
+		/// <summary>
+		/// Gets the smallest box containing this box and a point.
+		/// </summary>
+		/// <param name="point"> The point. </param>
+		/// <returns> The combined box. </returns>
+		Aabb Union(const Vector3 &point) const;
+
+		/// <summary>
+		/// Gets this box grown on every side.
+		/// </summary>
+		/// <param name="margin"> The distance to grow each side by. </param>
+		/// <returns> The grown box. </returns>
+		Aabb Expand(const float &margin) const;
+
+		/// <summary>
+		/// Gets the box containing this box after being transformed.
+		/// </summary>
+		/// <param name="matrix"> The transformation matrix. </param>
+		/// <returns> The transformed box. </returns>
+		Aabb Transform(const Matrix4 &matrix) const;
+
+		/// <summary>
+		/// Gets if this box fully contains another.
+		/// </summary>
+		/// <param name="other"> The other box. </param>
+		/// <returns> If the other box is inside. </returns>
+		bool Contains(const Aabb &other) const;
+
+		/// <summary>
+		/// Gets if this box overlaps another.
+		/// </summary>
+		/// <param name="other"> The other box. </param>
+		/// <returns> If the boxes overlap. </returns>
+		bool Intersects(const Aabb &other) const;
+
+		/// <summary>
+		/// Gets if this box overlaps a sphere.
+		/// </summary>
+		/// <param name="centre"> The spheres centre. </param>
+		/// <param name="radius"> The spheres radius. </param>
+		/// <returns> If the sphere overlaps. </returns>
+		bool Intersects(const Vector3 &centre, const float &radius) const;
+
+		/// <summary>
+		/// Finds where a ray enters this box.
+		/// </summary>
+		/// <param name="origin"> The rays origin. </param>
+		/// <param name="inverseDirection"> One over each component of the rays direction, so one ray can be tested against many boxes without dividing. </param>
+		/// <param name="distance"> The furthest distance along the ray to test. </param>
+		/// <returns> The distance the ray enters the box, 0 if the origin is inside, or nothing if it misses. </returns>
+		std::optional<float> Intersects(const Vector3 &origin, const Vector3 &inverseDirection, const float &distance) const;
+	};
+}
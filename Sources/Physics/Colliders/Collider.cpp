@@ -1,7 +1,6 @@
 #include "Collider.hpp"
 
 #include <BulletCollision/CollisionShapes/btCollisionShape.h>
-#include "Maths/Maths.hpp"
 #include "Scenes/Entity.hpp"
 #include "Physics/CollisionObject.hpp"
 
@@ -12,7 +11,7 @@ namespace acid
 		m_gizmo(nullptr)
 	{
 #if defined(ACID_VERBOSE)
-		if (gizmoType != nullptr)
+		if (gizmoType != nullptr && Gizmos::Get() != nullptr)
 		{
 			m_gizmo = Gizmos::Get()->AddGizmo(new Gizmo(gizmoType, localTransform));
 		}
@@ -21,7 +20,10 @@ namespace acid
 
 	Collider::~Collider()
 	{
-		Gizmos::Get()->RemoveGizmo(m_gizmo);
+		if (m_gizmo != nullptr)
+		{
+			Gizmos::Get()->RemoveGizmo(m_gizmo);
+		}
 	}
 
 	void Collider::Update()
@@ -66,23 +68,15 @@ namespace acid
 
 	btTransform Collider::Convert(const Transform &transform)
 	{
-		btQuaternion rotation = btQuaternion();
-		rotation.setEulerZYX(transform.GetRotation().m_y * DEG_TO_RAD,
-			transform.GetRotation().m_x * DEG_TO_RAD, transform.GetRotation().m_z * DEG_TO_RAD);
-
 		btTransform worldTransform = btTransform();
 		worldTransform.setIdentity();
 		worldTransform.setOrigin(Collider::Convert(transform.GetPosition()));
-		worldTransform.setRotation(rotation);
+		worldTransform.setRotation(Collider::Convert(transform.GetRotation()));
 		return worldTransform;
 	}
 
 	Transform Collider::Convert(const btTransform &transform, const Vector3 &scaling)
 	{
-		btVector3 position = transform.getOrigin();
-		float yaw, pitch, roll;
-		transform.getBasis().getEulerYPR(yaw, pitch, roll);
-		return Transform(Collider::Convert(position), Vector3(pitch * RAD_TO_DEG,
-			yaw * RAD_TO_DEG, roll * RAD_TO_DEG), scaling);
+		return Transform(Collider::Convert(transform.getOrigin()), Collider::Convert(transform.getRotation()), scaling);
 	}
 }
@@ -32,6 +32,19 @@ namespace acid
 		return force;
 	}
 
+	std::optional<Aabb> CollisionObject::GetBounds() const
+	{
+		if (m_body == nullptr || m_shape == nullptr)
+		{
+			return {};
+		}
+
+		btVector3 min = btVector3();
+		btVector3 max = btVector3();
+		m_shape->getAabb(m_body->getWorldTransform(), min, max);
+		return Aabb(Collider::Convert(min), Collider::Convert(max));
+	}
+
 	void CollisionObject::SetChildTransform(Collider *child, const Transform &transform)
 	{
 		auto compoundShape = dynamic_cast<btCompoundShape *>(m_shape.get());
@@ -49,6 +49,8 @@ namespace acid
 		/// <returns> If the shape is partially in the view frustum. </returns>
 		virtual bool InFrustum(const Frustum &frustum) = 0;
 
+		std::optional<Aabb> GetBounds() const override;
+
 		Force *AddForce(Force *force);
 
 		template<typename T, typename... Args>
@@ -1,12 +1,29 @@
 #include "Frustum.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include "Maths/Simd.hpp"
+#include "Aabb.hpp"
 
 namespace acid
 {
 	const Frustum Frustum::ZERO = Frustum();
 
+	/// <summary>
+	/// Copies every plane value into all lanes, so each lane can test a different object.
+	/// </summary>
+	static void LoadPlanes(const std::array<std::array<float, 4>, 6> &frustum, Simd::Float4 planes[6][4])
+	{
+		for (uint32_t side = 0; side < 6; side++)
+		{
+			for (uint32_t j = 0; j < 4; j++)
+			{
+				planes[side][j] = Simd::Splat(frustum[side][j]);
+			}
+		}
+	}
+
 	Frustum::Frustum() :
 		m_frustum(std::array<std::array<float, 4>, 6>())
 	{
@@ -133,6 +150,86 @@ namespace acid
 		return true;
 	}
 
+	void Frustum::CullSpheres(const Vector3 *centres, const float *radii, const std::size_t &count, uint32_t *visible) const
+	{
+		Simd::Float4 planes[6][4];
+		LoadPlanes(m_frustum, planes);
+		std::fill(visible, visible + GetMaskWords(count), 0u);
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			auto x = Simd::Set(centres[i].m_x, centres[i + 1].m_x, centres[i + 2].m_x, centres[i + 3].m_x);
+			auto y = Simd::Set(centres[i].m_y, centres[i + 1].m_y, centres[i + 2].m_y, centres[i + 3].m_y);
+			auto z = Simd::Set(centres[i].m_z, centres[i + 1].m_z, centres[i + 2].m_z, centres[i + 3].m_z);
+			auto radius = Simd::FlipSigns<true, true, true, true>(Simd::Load(radii + i));
+			uint32_t outside = 0;
+
+			// Every plane is tested without branching, a sphere is outside if it is behind any of them.
+			for (uint32_t side = 0; side < 6; side++)
+			{
+				auto distance = Simd::Add(Simd::Add(Simd::Multiply(planes[side][0], x), Simd::Multiply(planes[side][1], y)), Simd::Multiply(planes[side][2], z));
+				outside |= Simd::LessEqual(Simd::Add(distance, planes[side][3]), radius);
+			}
+
+			visible[i / 32] |= (~outside & 0xFu) << (i % 32);
+		}
+
+		for (; i < count; i++)
+		{
+			if (SphereInFrustum(centres[i], radii[i]))
+			{
+				visible[i / 32] |= 1u << (i % 32);
+			}
+		}
+	}
+
+	void Frustum::CullAABBs(const Aabb *bounds, const std::size_t &count, uint32_t *visible) const
+	{
+		Simd::Float4 planes[6][4];
+		LoadPlanes(m_frustum, planes);
+		std::fill(visible, visible + GetMaskWords(count), 0u);
+		auto zero = Simd::Splat(0.0f);
+		std::size_t i = 0;
+
+		for (; i + 4 <= count; i += 4)
+		{
+			auto &a = bounds[i];
+			auto &b = bounds[i + 1];
+			auto &c = bounds[i + 2];
+			auto &d = bounds[i + 3];
+			Simd::Float4 min[3] = {
+				Simd::Set(a.m_min.m_x, b.m_min.m_x, c.m_min.m_x, d.m_min.m_x), Simd::Set(a.m_min.m_y, b.m_min.m_y, c.m_min.m_y, d.m_min.m_y),
+				Simd::Set(a.m_min.m_z, b.m_min.m_z, c.m_min.m_z, d.m_min.m_z)
+			};
+			Simd::Float4 max[3] = {
+				Simd::Set(a.m_max.m_x, b.m_max.m_x, c.m_max.m_x, d.m_max.m_x), Simd::Set(a.m_max.m_y, b.m_max.m_y, c.m_max.m_y, d.m_max.m_y),
+				Simd::Set(a.m_max.m_z, b.m_max.m_z, c.m_max.m_z, d.m_max.m_z)
+			};
+
+			uint32_t outside = 0;
+
+			// The largest product on each axis picks the corner furthest in front, if it is behind the plane every corner is.
+			for (uint32_t side = 0; side < 6; side++)
+			{
+				auto distance = Simd::Max(Simd::Multiply(planes[side][0], min[0]), Simd::Multiply(planes[side][0], max[0]));
+				distance = Simd::Add(distance, Simd::Max(Simd::Multiply(planes[side][1], min[1]), Simd::Multiply(planes[side][1], max[1])));
+				distance = Simd::Add(distance, Simd::Max(Simd::Multiply(planes[side][2], min[2]), Simd::Multiply(planes[side][2], max[2])));
+				outside |= Simd::LessEqual(Simd::Add(distance, planes[side][3]), zero);
+			}
+
+			visible[i / 32] |= (~outside & 0xFu) << (i % 32);
+		}
+
+		for (; i < count; i++)
+		{
+			if (CubeInFrustum(bounds[i].m_min, bounds[i].m_max))
+			{
+				visible[i / 32] |= 1u << (i % 32);
+			}
+		}
+	}
+
 	void Frustum::NormalizePlane(const int32_t &side)
 	{
 		float magnitude = std::sqrt(m_frustum[side][0] * m_frustum[side][0] +
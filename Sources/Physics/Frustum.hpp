@@ -1,10 +1,13 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include "Maths/Matrix4.hpp"
 
 namespace acid
 {
+	class Aabb;
+
 	/// <summary>
 	/// Represents the region of space in the modeled world that may appear on the screen.
 	/// </summary>
@@ -50,6 +53,40 @@ namespace acid
 		/// <returns> True if partially contained, false if outside. </returns>
 		bool CubeInFrustum(const Vector3 &min, const Vector3 &max) const;
 
+		/// <summary>
+		/// Finds which spheres are contained in the frustum, four are tested against every plane at once.
+		/// Each result is the same as <seealso cref="#SphereInFrustum"/>.
+		/// </summary>
+		/// <param name="centres"> The spheres centres. </param>
+		/// <param name="radii"> The spheres radii. </param>
+		/// <param name="count"> The amount of spheres. </param>
+		/// <param name="visible"> The mask set with a bit for each contained sphere, <seealso cref="#GetMaskWords"/> words long. </param>
+		void CullSpheres(const Vector3 *centres, const float *radii, const std::size_t &count, uint32_t *visible) const;
+
+		/// <summary>
+		/// Finds which boxes are partially contained in the frustum, four are tested against every plane at once.
+		/// Only the corner furthest along each plane is tested, which gives the same result as <seealso cref="#CubeInFrustum"/>.
+		/// </summary>
+		/// <param name="bounds"> The boxes. </param>
+		/// <param name="count"> The amount of boxes. </param>
+		/// <param name="visible"> The mask set with a bit for each partially contained box, <seealso cref="#GetMaskWords"/> words long. </param>
+		void CullAABBs(const Aabb *bounds, const std::size_t &count, uint32_t *visible) const;
+
+		/// <summary>
+		/// Gets the amount of words a culling mask needs.
+		/// </summary>
+		/// <param name="count"> The amount of objects culled. </param>
+		/// <returns> The amount of words. </returns>
+		static std::size_t GetMaskWords(const std::size_t &count) { return (count + 31) / 32; }
+
+		/// <summary>
+		/// Gets if an object was found in the frustum by a cull.
+		/// </summary>
+		/// <param name="visible"> The culling mask. </param>
+		/// <param name="index"> The index of the object. </param>
+		/// <returns> If the object is visible. </returns>
+		static bool IsVisible(const uint32_t *visible, const std::size_t &index) { return (visible[index / 32] >> (index % 32) & 1u) != 0; }
+
 	private:
 		void NormalizePlane(const int32_t &side);
 	};
@@ -1,14 +1,12 @@
 #include "RendererDeferred.hpp"
 
 #include "Helpers/FileSystem.hpp"
-#include "Lights/Light.hpp"
+#include "Memory/FrameArena.hpp"
 #include "Models/Shapes/ModelRectangle.hpp"
 #include "Models/VertexModel.hpp"
 #include "Renderer/Pipelines/PipelineCompute.hpp"
 #include "Renderer/Renderer.hpp"
-#include "Scenes/Scenes.hpp"
 #include "Shadows/Shadows.hpp"
-#include "Skyboxes/MaterialSkybox.hpp"
 #include "Textures/DepthStencil.hpp"
 
 namespace acid
@@ -42,8 +40,7 @@ namespace acid
 	{
 		if (m_lightModel == DEFERRED_IBL)
 		{
-			auto materialSkybox = Scenes::Get()->GetStructure()->GetComponent<MaterialSkybox>();
-			auto skybox = (materialSkybox == nullptr) ? nullptr : materialSkybox->GetCubemap();
+			auto &skybox = Renderer::Get()->GetSnapshot().GetSkybox();
 
 			if (m_skybox != skybox)
 			{
@@ -53,25 +50,20 @@ namespace acid
 		}
 
 		// Updates uniforms.
-		std::vector<DeferredLight> deferredLights(MAX_LIGHTS);
+		FrameVector<DeferredLight> deferredLights(MAX_LIGHTS);
 		uint32_t lightCount = 0;
 
-		auto sceneLights = Scenes::Get()->GetStructure()->QueryComponents<Light>();
-
-		for (auto &light : sceneLights)
+		for (auto &light : Renderer::Get()->GetSnapshot().GetLights())
 		{
-		//	auto position = *light->GetPosition();
-		//	float radius = light->GetRadius();
-
-		//	if (radius >= 0.0f && !camera.GetViewFrustum()->SphereInFrustum(position, radius))
+		//	if (light.m_radius >= 0.0f && !camera.GetViewFrustum().SphereInFrustum(light.m_position, light.m_radius))
 		//	{
 		//		continue;
 		//	}
 
 			DeferredLight deferredLight = {};
-			deferredLight.m_colour = light->GetColour();
-			deferredLight.m_position = light->GetWorldTransform().GetPosition();
-			deferredLight.m_radius = light->GetRadius();
+			deferredLight.m_colour = light.m_colour;
+			deferredLight.m_position = light.m_position;
+			deferredLight.m_radius = light.m_radius;
 			deferredLights[lightCount] = deferredLight;
 			lightCount++;
 
@@ -0,0 +1,100 @@
+#include "FrameSnapshot.hpp"
+
+#include <algorithm>
+#include "Lights/Light.hpp"
+#include "Meshes/MeshRender.hpp"
+#include "Scenes/Scenes.hpp"
+#include "Shadows/ShadowRender.hpp"
+#include "Skyboxes/MaterialSkybox.hpp"
+
+namespace acid
+{
+	CameraSnapshot::CameraSnapshot() :
+		m_nearPlane(0.1f),
+		m_farPlane(1000.0f),
+		m_fov(180.0f),
+		m_viewFrustum(Frustum()),
+		m_viewRay(Ray::ZERO),
+		m_viewMatrix(Matrix4::IDENTITY),
+		m_projectionMatrix(Matrix4::IDENTITY),
+		m_position(Vector3::ZERO),
+		m_rotation(Vector3::ZERO),
+		m_velocity(Vector3::ZERO)
+	{
+	}
+
+	void CameraSnapshot::Capture(const Camera &camera)
+	{
+		m_nearPlane = camera.GetNearPlane();
+		m_farPlane = camera.GetFarPlane();
+		m_fov = camera.GetFov();
+		m_viewFrustum = camera.GetViewFrustum();
+		m_viewRay = camera.GetViewRay();
+		m_viewMatrix = camera.GetViewMatrix();
+		m_projectionMatrix = camera.GetProjectionMatrix();
+		m_position = camera.GetPosition();
+		m_rotation = camera.GetRotation();
+		m_velocity = camera.GetVelocity();
+	}
+
+	FrameSnapshot::FrameSnapshot() :
+		m_camera(CameraSnapshot()),
+		m_meshRenders(std::vector<MeshRender *>()),
+		m_shadowRenders(std::vector<ShadowRender *>()),
+		m_lights(std::vector<LightSnapshot>()),
+		m_skybox(nullptr)
+	{
+	}
+
+	void FrameSnapshot::Capture()
+	{
+		m_meshRenders.clear();
+		m_shadowRenders.clear();
+		m_lights.clear();
+		m_skybox = nullptr;
+
+		auto camera = Scenes::Get()->GetCamera();
+		auto structure = Scenes::Get()->GetStructure();
+
+		if (camera == nullptr || structure == nullptr)
+		{
+			return;
+		}
+
+		m_camera.Capture(*camera);
+
+		// Only entities in the view frustum are visited, they are found through the structures bounding tree.
+		structure->QueryFrustum(m_camera.GetViewFrustum(), [&](Entity *entity)
+		{
+			for (auto &meshRender : entity->GetComponents<MeshRender>())
+			{
+				if (meshRender->IsEnabled() && meshRender->Capture(m_camera))
+				{
+					m_meshRenders.emplace_back(meshRender);
+				}
+			}
+		});
+
+		std::sort(m_meshRenders.begin(), m_meshRenders.end(), [](const MeshRender *a, const MeshRender *b)
+		{
+			return a->GetCameraDistance() < b->GetCameraDistance();
+		});
+
+		for (auto &shadowRender : structure->QueryComponents<ShadowRender>())
+		{
+			m_shadowRenders.emplace_back(shadowRender);
+		}
+
+		for (auto &light : structure->QueryComponents<Light>())
+		{
+			m_lights.emplace_back(LightSnapshot{light->GetColour(), light->GetWorldTransform().GetPosition(), light->GetRadius()});
+		}
+
+		auto materialSkybox = structure->GetComponent<MaterialSkybox>();
+
+		if (materialSkybox != nullptr)
+		{
+			m_skybox = materialSkybox->GetCubemap();
+		}
+	}
+}
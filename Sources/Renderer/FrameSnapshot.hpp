@@ -0,0 +1,121 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include "Maths/Colour.hpp"
+#include "Scenes/Camera.hpp"
+
+namespace acid
+{
+	class Cubemap;
+	class MeshRender;
+	class ShadowRender;
+
+	/// <summary>
+	/// The state of a light when a frame was captured.
+	/// </summary>
+	struct LightSnapshot
+	{
+		Colour m_colour;
+		Vector3 m_position;
+		float m_radius;
+	};
+
+	/// <summary>
+	/// A copy of the camera state taken at the start of a frame, renderers read this while the next update changes the real camera.
+	/// </summary>
+	class ACID_EXPORT CameraSnapshot :
+		public Camera
+	{
+	private:
+		float m_nearPlane;
+		float m_farPlane;
+		float m_fov;
+		Frustum m_viewFrustum;
+		Ray m_viewRay;
+		Matrix4 m_viewMatrix;
+		Matrix4 m_projectionMatrix;
+		Vector3 m_position;
+		Vector3 m_rotation;
+		Vector3 m_velocity;
+	public:
+		CameraSnapshot();
+
+		/// <summary>
+		/// Copies the current state of a camera.
+		/// </summary>
+		/// <param name="camera"> The camera to copy. </param>
+		void Capture(const Camera &camera);
+
+		float GetNearPlane() const override { return m_nearPlane; }
+
+		float GetFarPlane() const override { return m_farPlane; }
+
+		float GetFov() const override { return m_fov; }
+
+		Frustum GetViewFrustum() const override { return m_viewFrustum; }
+
+		Ray GetViewRay() const override { return m_viewRay; }
+
+		Matrix4 GetViewMatrix() const override { return m_viewMatrix; }
+
+		Matrix4 GetProjectionMatrix() const override { return m_projectionMatrix; }
+
+		Vector3 GetPosition() const override { return m_position; }
+
+		Vector3 GetRotation() const override { return m_rotation; }
+
+		Vector3 GetVelocity() const override { return m_velocity; }
+	};
+
+	/// <summary>
+	/// The immutable state a frame is rendered from. It is captured on the main thread between updates,
+	/// after that renderers only read from the snapshot so the frame can be recorded while the next update runs.
+	/// </summary>
+	class ACID_EXPORT FrameSnapshot
+	{
+	private:
+		CameraSnapshot m_camera;
+		std::vector<MeshRender *> m_meshRenders;
+		std::vector<ShadowRender *> m_shadowRenders;
+		std::vector<LightSnapshot> m_lights;
+		std::shared_ptr<Cubemap> m_skybox;
+	public:
+		FrameSnapshot();
+
+		/// <summary>
+		/// Captures the camera, the visible mesh renders and their uniforms, the shadow renders, the lights and the skybox from the current scene.
+		/// </summary>
+		void Capture();
+
+		/// <summary>
+		/// Gets the camera the frame is rendered from.
+		/// </summary>
+		/// <returns> The camera snapshot. </returns>
+		const CameraSnapshot &GetCamera() const { return m_camera; }
+
+		/// <summary>
+		/// Gets the mesh renders that were visible when captured, sorted from the closest to the furthest away.
+		/// </summary>
+		/// <returns> The visible mesh renders. </returns>
+		const std::vector<MeshRender *> &GetMeshRenders() const { return m_meshRenders; }
+
+		/// <summary>
+		/// Gets the shadow renders in the scene when captured.
+		/// </summary>
+		/// <returns> The shadow renders. </returns>
+		const std::vector<ShadowRender *> &GetShadowRenders() const { return m_shadowRenders; }
+
+		/// <summary>
+		/// Gets the enabled lights in the scene when captured.
+		/// </summary>
+		/// <returns> The light snapshots. </returns>
+		const std::vector<LightSnapshot> &GetLights() const { return m_lights; }
+
+		/// <summary>
+		/// Gets the cubemap of the first skybox material in the scene when captured.
+		/// </summary>
+		/// <returns> The skybox cubemap, or nullptr if there is no skybox. </returns>
+		const std::shared_ptr<Cubemap> &GetSkybox() const { return m_skybox; }
+	};
+}
@@ -3,6 +3,7 @@
 #include <cmath>
 #include <cassert>
 #include "Display/Display.hpp"
+#include "Engine/Profiler.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Renderer/Renderer.hpp"
 
@@ -25,6 +26,8 @@ namespace acid
 		m_pipeline(VK_NULL_HANDLE),
 		m_pipelineLayout(VK_NULL_HANDLE)
 	{
+		ACID_PROFILE_SCOPE("PipelineCompute::Create");
+
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
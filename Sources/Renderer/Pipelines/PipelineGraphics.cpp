@@ -3,6 +3,7 @@
 #include <cassert>
 #include <algorithm>
 #include "Display/Display.hpp"
+#include "Engine/Profiler.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Renderer/Renderer.hpp"
 
@@ -45,6 +46,8 @@ namespace acid
 		m_dynamicState({}),
 		m_tessellationState({})
 	{
+		ACID_PROFILE_SCOPE("PipelineGraphics::Create");
+
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
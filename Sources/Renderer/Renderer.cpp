@@ -1,6 +1,7 @@
 #include "Renderer.hpp"
 
 #include <cassert>
+#include "Engine/Profiler.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Scenes/Scenes.hpp"
 #include "RenderPipeline.hpp"
@@ -17,7 +18,10 @@ namespace acid
 		m_pipelineCache(VK_NULL_HANDLE),
 		m_semaphore(VK_NULL_HANDLE),
 		m_commandPool(VK_NULL_HANDLE),
-		m_commandBuffer(nullptr)
+		m_commandBuffer(nullptr),
+		m_snapshot(FrameSnapshot()),
+		m_pipelined(false),
+		m_frameJob(JobHandle())
 	{
 		CreateFences();
 		CreateCommandPool();
@@ -26,6 +30,8 @@ namespace acid
 
 	Renderer::~Renderer()
 	{
+		WaitFrame();
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 		auto graphicsQueue = Display::Get()->GetGraphicsQueue();
 
@@ -40,6 +46,9 @@ namespace acid
 
 	void Renderer::Update()
 	{
+		// The previous frame has to finish before the next snapshot is captured.
+		WaitFrame();
+
 		if (Display::Get()->IsIconified() || m_renderManager == nullptr)
 		{
 			return;
@@ -55,7 +64,38 @@ namespace acid
 
 		m_renderManager->Update();
 
-		auto camera = Scenes::Get()->GetCamera();
+		{
+			ACID_PROFILE_SCOPE("FrameSnapshot::Capture");
+			m_snapshot.Capture();
+		}
+
+		if (m_pipelined)
+		{
+			m_frameJob = Engine::Get()->GetJobSystem().Schedule([this]()
+			{
+				RecordFrame();
+			});
+			return;
+		}
+
+		RecordFrame();
+	}
+
+	void Renderer::SetPipelined(const bool &pipelined)
+	{
+		WaitFrame();
+		m_pipelined = pipelined;
+	}
+
+	void Renderer::WaitFrame()
+	{
+		Engine::Get()->GetJobSystem().Wait(m_frameJob);
+		m_frameJob = JobHandle();
+	}
+
+	void Renderer::RecordFrame()
+	{
+		ACID_PROFILE_SCOPE("Renderer::RecordFrame");
 		auto &stages = m_rendererRegister.GetStages();
 
 		if (stages.empty())
@@ -116,7 +156,8 @@ namespace acid
 					continue;
 				}
 
-				renderer->Render(*m_commandBuffer, *camera);
+				ACID_PROFILE_SCOPE(Profiler::GetTypeName(typeid(*renderer)));
+				renderer->Render(*m_commandBuffer, m_snapshot.GetCamera());
 			}
 		}
 
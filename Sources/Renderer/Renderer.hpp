@@ -5,6 +5,7 @@
 #include "Commands/CommandBuffer.hpp"
 #include "Swapchain/Swapchain.hpp"
 #include "Textures/DepthStencil.hpp"
+#include "FrameSnapshot.hpp"
 #include "RenderManager.hpp"
 #include "RendererRegister.hpp"
 #include "RenderStage.hpp"
@@ -31,6 +32,10 @@ namespace acid
 		VkCommandPool m_commandPool;
 
 		std::unique_ptr<CommandBuffer> m_commandBuffer;
+
+		FrameSnapshot m_snapshot;
+		bool m_pipelined;
+		JobHandle m_frameJob;
 	public:
 		/// <summary>
 		/// Gets this engine instance.
@@ -70,6 +75,30 @@ namespace acid
 		/// <returns> The renderer register. </returns>
 		RendererRegister &GetRendererRegister() { return m_rendererRegister; }
 
+		/// <summary>
+		/// Gets the snapshot the current frame is rendered from, renderers should read scene state from this instead of the scene.
+		/// </summary>
+		/// <returns> The frame snapshot. </returns>
+		const FrameSnapshot &GetSnapshot() const { return m_snapshot; }
+
+		/// <summary>
+		/// Gets if frames are recorded on a worker while the next update runs.
+		/// </summary>
+		/// <returns> If the renderer is pipelined. </returns>
+		bool IsPipelined() const { return m_pipelined; }
+
+		/// <summary>
+		/// Sets if frames are recorded on a worker while the next update runs. Every registered render pipeline must only read
+		/// scene state through <seealso cref="#GetSnapshot()"/>, and GPU resources should not be uploaded from updates while enabled.
+		/// </summary>
+		/// <param name="pipelined"> If the renderer is pipelined. </param>
+		void SetPipelined(const bool &pipelined);
+
+		/// <summary>
+		/// Waits for the frame being recorded to finish, must be called before destroying anything the frame may be reading.
+		/// </summary>
+		void WaitFrame();
+
 		RenderStage *GetRenderStage(const uint32_t &index) const;
 
 		Descriptor *GetAttachment(const std::string &name) const;
@@ -84,6 +113,8 @@ namespace acid
 
 		VkPipelineCache GetPipelineCache() const { return m_pipelineCache; }
 	private:
+		void RecordFrame();
+
 		void CreateFences();
 
 		void CreateCommandPool();
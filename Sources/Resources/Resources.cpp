@@ -1,6 +1,7 @@
 #include "Resources.hpp"
 
 #include <algorithm>
+#include "Display/Display.hpp"
 
 namespace acid
 {
@@ -9,6 +10,7 @@ namespace acid
 		m_resources(std::vector<std::shared_ptr<Resource>>()),
 		m_timerPurge(Timer(Time::Seconds(5.0f)))
 	{
+		Writes<Resources>();
 	}
 
 	void Resources::Update()
@@ -85,4 +87,9 @@ namespace acid
 			}
 		}
 	}
+
+	bool Resources::HasDevice()
+	{
+		return Display::Get() != nullptr;
+	}
 }
@@ -37,5 +37,12 @@ namespace acid
 		void Remove(const std::shared_ptr<Resource> &resource);
 
 		void Remove(const std::string &filename);
+
+		/// <summary>
+		/// Gets if resources backed by the GPU can create their device objects.
+		/// A headless engine has no device, those resources then only keep their name and settings so they can still be found, decoded and encoded.
+		/// </summary>
+		/// <returns> If there is a device to create resources on. </returns>
+		static bool HasDevice();
 	};
 }
@@ -0,0 +1,38 @@
+#include "Archetype.hpp"
+
+namespace acid
+{
+	Archetype::Archetype(const std::vector<uint32_t> &signature) :
+		m_signature(signature),
+		m_entities(std::vector<Entity *>()),
+		m_columns(std::vector<std::vector<Component *>>(signature.size())),
+		m_queryColumns(std::vector<std::pair<uint32_t, std::optional<uint32_t>>>())
+	{
+	}
+
+	uint32_t Archetype::Add(Entity *entity, const std::vector<Component *> &components)
+	{
+		for (uint32_t i = 0; i < m_columns.size(); i++)
+		{
+			m_columns[i].emplace_back(components[i]);
+		}
+
+		m_entities.emplace_back(entity);
+		return static_cast<uint32_t>(m_entities.size() - 1);
+	}
+
+	Entity *Archetype::Remove(const uint32_t &row)
+	{
+		uint32_t last = static_cast<uint32_t>(m_entities.size() - 1);
+
+		for (auto &column : m_columns)
+		{
+			column[row] = column[last];
+			column.pop_back();
+		}
+
+		m_entities[row] = m_entities[last];
+		m_entities.pop_back();
+		return row == last ? nullptr : m_entities[row];
+	}
+}
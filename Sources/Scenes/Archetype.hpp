@@ -0,0 +1,89 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+#include "Entity.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A table of every entity in a structure with the same set of component types.
+	/// Components are kept in a packed column per type, so a query reads them in order instead of searching every entity.
+	/// </summary>
+	class ACID_EXPORT Archetype
+	{
+	private:
+		std::vector<uint32_t> m_signature;
+		std::vector<Entity *> m_entities;
+		std::vector<std::vector<Component *>> m_columns;
+		std::vector<std::pair<uint32_t, std::optional<uint32_t>>> m_queryColumns;
+	public:
+		/// <summary>
+		/// Creates a new archetype.
+		/// </summary>
+		/// <param name="signature"> The sorted type ids of the components, a type is repeated for every component of it. </param>
+		explicit Archetype(const std::vector<uint32_t> &signature);
+
+		/// <summary>
+		/// Adds a row to the table.
+		/// </summary>
+		/// <param name="entity"> The entity. </param>
+		/// <param name="components"> The entities components, in the order of the signature. </param>
+		/// <returns> The row the entity was added into. </returns>
+		uint32_t Add(Entity *entity, const std::vector<Component *> &components);
+
+		/// <summary>
+		/// Removes a row from the table, the last row is moved into its place.
+		/// </summary>
+		/// <param name="row"> The row to remove. </param>
+		/// <returns> The entity that was moved into the row, nullptr if the last row was removed. </returns>
+		Entity *Remove(const uint32_t &row);
+
+		/// <summary>
+		/// Finds the column holding a component type, base types are found by the first column holding a type derived from it.
+		/// </summary>
+		/// <param name="T"> The component type. </param>
+		/// <returns> The column index, or nothing if no column holds the type. </returns>
+		template<typename T>
+		std::optional<uint32_t> FindColumn()
+		{
+			auto typeId = Entity::GetTypeId<T>();
+
+			for (auto &[queryId, column] : m_queryColumns)
+			{
+				if (queryId == typeId)
+				{
+					return column;
+				}
+			}
+
+			// The types in a archetype are fixed, so one row is enough to check what a column can be cast to.
+			if (m_entities.empty())
+			{
+				return {};
+			}
+
+			std::optional<uint32_t> result = {};
+
+			for (uint32_t i = 0; i < m_columns.size(); i++)
+			{
+				if (m_signature[i] == typeId || dynamic_cast<T *>(m_columns[i][0]) != nullptr)
+				{
+					result = i;
+					break;
+				}
+			}
+
+			m_queryColumns.emplace_back(typeId, result);
+			return result;
+		}
+
+		const std::vector<uint32_t> &GetSignature() const { return m_signature; }
+
+		uint32_t GetSize() const { return static_cast<uint32_t>(m_entities.size()); }
+
+		Entity *GetEntity(const uint32_t &row) const { return m_entities[row]; }
+
+		const std::vector<Component *> &GetColumn(const uint32_t &column) const { return m_columns[column]; }
+	};
+}
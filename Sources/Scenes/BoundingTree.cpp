@@ -0,0 +1,288 @@
+#include "BoundingTree.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace acid
+{
+	const uint32_t BoundingTree::NULL_NODE = std::numeric_limits<uint32_t>::max();
+	const float BoundingTree::MARGIN = 0.1f;
+
+	BoundingTree::BoundingTree() :
+		m_nodes(std::vector<Node>()),
+		m_root(NULL_NODE),
+		m_free(NULL_NODE),
+		m_size(0)
+	{
+	}
+
+	uint32_t BoundingTree::Insert(Entity *entity, const Aabb &bounds)
+	{
+		auto leaf = AllocateNode();
+		m_nodes[leaf].m_bounds = bounds.Expand(MARGIN);
+		m_nodes[leaf].m_entity = entity;
+		InsertLeaf(leaf);
+		m_size++;
+		return leaf;
+	}
+
+	void BoundingTree::Remove(const uint32_t &leaf)
+	{
+		RemoveLeaf(leaf);
+		FreeNode(leaf);
+		m_size--;
+	}
+
+	bool BoundingTree::Update(const uint32_t &leaf, const Aabb &bounds)
+	{
+		auto &grown = m_nodes[leaf].m_bounds;
+
+		// Bounds that shrunk well inside the grown bounds are also reinserted, so the tree stays tight.
+		if (grown.Contains(bounds) && bounds.Expand(4.0f * MARGIN).Contains(grown))
+		{
+			return false;
+		}
+
+		RemoveLeaf(leaf);
+		m_nodes[leaf].m_bounds = bounds.Expand(MARGIN);
+		InsertLeaf(leaf);
+		return true;
+	}
+
+	void BoundingTree::Clear()
+	{
+		m_nodes.clear();
+		m_root = NULL_NODE;
+		m_free = NULL_NODE;
+		m_size = 0;
+	}
+
+	uint32_t BoundingTree::AllocateNode()
+	{
+		uint32_t node = m_free;
+
+		if (node == NULL_NODE)
+		{
+			node = static_cast<uint32_t>(m_nodes.size());
+			m_nodes.emplace_back();
+		}
+		else
+		{
+			m_free = m_nodes[node].m_parent;
+		}
+
+		m_nodes[node] = {Aabb(), nullptr, NULL_NODE, NULL_NODE, NULL_NODE, 0};
+		return node;
+	}
+
+	void BoundingTree::FreeNode(const uint32_t &node)
+	{
+		// Free nodes are linked through their parent index.
+		m_nodes[node].m_parent = m_free;
+		m_nodes[node].m_height = -1;
+		m_free = node;
+	}
+
+	void BoundingTree::InsertLeaf(const uint32_t &leaf)
+	{
+		if (m_root == NULL_NODE)
+		{
+			m_root = leaf;
+			m_nodes[leaf].m_parent = NULL_NODE;
+			return;
+		}
+
+		// Walks down to the sibling that grows the surface area of the tree the least.
+		auto leafBounds = m_nodes[leaf].m_bounds;
+		uint32_t index = m_root;
+
+		while (!m_nodes[index].IsLeaf())
+		{
+			auto &node = m_nodes[index];
+			float area = node.m_bounds.GetSurfaceArea();
+			float combinedArea = node.m_bounds.Union(leafBounds).GetSurfaceArea();
+
+			// The cost of making a new parent for this node and the leaf, and the cost pushed down onto any child.
+			float cost = 2.0f * combinedArea;
+			float inheritedCost = 2.0f * (combinedArea - area);
+
+			auto childCost = [&](const uint32_t &child)
+			{
+				auto &childNode = m_nodes[child];
+				float childArea = childNode.m_bounds.Union(leafBounds).GetSurfaceArea();
+
+				if (childNode.IsLeaf())
+				{
+					return childArea + inheritedCost;
+				}
+
+				return childArea - childNode.m_bounds.GetSurfaceArea() + inheritedCost;
+			};
+
+			float costLeft = childCost(node.m_left);
+			float costRight = childCost(node.m_right);
+
+			if (cost < costLeft && cost < costRight)
+			{
+				break;
+			}
+
+			index = costLeft < costRight ? node.m_left : node.m_right;
+		}
+
+		uint32_t sibling = index;
+		uint32_t oldParent = m_nodes[sibling].m_parent;
+		uint32_t newParent = AllocateNode();
+
+		auto &parentNode = m_nodes[newParent];
+		parentNode.m_parent = oldParent;
+		parentNode.m_bounds = leafBounds.Union(m_nodes[sibling].m_bounds);
+		parentNode.m_height = m_nodes[sibling].m_height + 1;
+		parentNode.m_left = sibling;
+		parentNode.m_right = leaf;
+		m_nodes[sibling].m_parent = newParent;
+		m_nodes[leaf].m_parent = newParent;
+
+		if (oldParent == NULL_NODE)
+		{
+			m_root = newParent;
+		}
+		else if (m_nodes[oldParent].m_left == sibling)
+		{
+			m_nodes[oldParent].m_left = newParent;
+		}
+		else
+		{
+			m_nodes[oldParent].m_right = newParent;
+		}
+
+		Refit(m_nodes[leaf].m_parent);
+	}
+
+	void BoundingTree::RemoveLeaf(const uint32_t &leaf)
+	{
+		if (leaf == m_root)
+		{
+			m_root = NULL_NODE;
+			return;
+		}
+
+		// The leafs parent is removed and its sibling takes the parents place.
+		uint32_t parent = m_nodes[leaf].m_parent;
+		uint32_t grandParent = m_nodes[parent].m_parent;
+		uint32_t sibling = m_nodes[parent].m_left == leaf ? m_nodes[parent].m_right : m_nodes[parent].m_left;
+
+		m_nodes[sibling].m_parent = grandParent;
+		FreeNode(parent);
+
+		if (grandParent == NULL_NODE)
+		{
+			m_root = sibling;
+			return;
+		}
+
+		if (m_nodes[grandParent].m_left == parent)
+		{
+			m_nodes[grandParent].m_left = sibling;
+		}
+		else
+		{
+			m_nodes[grandParent].m_right = sibling;
+		}
+
+		Refit(grandParent);
+	}
+
+	void BoundingTree::Refit(uint32_t node)
+	{
+		while (node != NULL_NODE)
+		{
+			node = Balance(node);
+
+			auto &current = m_nodes[node];
+			auto &left = m_nodes[current.m_left];
+			auto &right = m_nodes[current.m_right];
+			current.m_height = 1 + std::max(left.m_height, right.m_height);
+			current.m_bounds = left.m_bounds.Union(right.m_bounds);
+
+			node = current.m_parent;
+		}
+	}
+
+	uint32_t BoundingTree::Balance(const uint32_t &node)
+	{
+		auto &current = m_nodes[node];
+
+		if (current.IsLeaf() || current.m_height < 2)
+		{
+			return node;
+		}
+
+		// Copied since rotating changes the nodes children.
+		uint32_t left = current.m_left;
+		uint32_t right = current.m_right;
+		int32_t balance = m_nodes[right].m_height - m_nodes[left].m_height;
+
+		if (balance > 1)
+		{
+			return Rotate(node, right);
+		}
+
+		if (balance < -1)
+		{
+			return Rotate(node, left);
+		}
+
+		return node;
+	}
+
+	uint32_t BoundingTree::Rotate(const uint32_t &node, const uint32_t &child)
+	{
+		auto &current = m_nodes[node];
+		auto &childNode = m_nodes[child];
+
+		// The child keeps its taller subtree, the node moves down and takes the shorter one in place of the child.
+		uint32_t taller = childNode.m_left;
+		uint32_t shorter = childNode.m_right;
+
+		if (m_nodes[taller].m_height < m_nodes[shorter].m_height)
+		{
+			std::swap(taller, shorter);
+		}
+
+		childNode.m_parent = current.m_parent;
+
+		if (childNode.m_parent == NULL_NODE)
+		{
+			m_root = child;
+		}
+		else if (m_nodes[childNode.m_parent].m_left == node)
+		{
+			m_nodes[childNode.m_parent].m_left = child;
+		}
+		else
+		{
+			m_nodes[childNode.m_parent].m_right = child;
+		}
+
+		if (current.m_left == child)
+		{
+			current.m_left = shorter;
+		}
+		else
+		{
+			current.m_right = shorter;
+		}
+
+		m_nodes[shorter].m_parent = node;
+		current.m_parent = child;
+		childNode.m_left = node;
+		childNode.m_right = taller;
+
+		current.m_height = 1 + std::max(m_nodes[current.m_left].m_height, m_nodes[current.m_right].m_height);
+		current.m_bounds = m_nodes[current.m_left].m_bounds.Union(m_nodes[current.m_right].m_bounds);
+		childNode.m_height = 1 + std::max(current.m_height, m_nodes[taller].m_height);
+		childNode.m_bounds = current.m_bounds.Union(m_nodes[taller].m_bounds);
+		return child;
+	}
+}
@@ -0,0 +1,164 @@
+#pragma once
+
+#include <vector>
+#include "Physics/Aabb.hpp"
+
+namespace acid
+{
+	class Entity;
+
+	/// <summary>
+	/// A dynamic bounding volume hierarchy of entity bounds, used to answer spatial queries without testing every entity.
+	/// Leaves hold bounds grown by a margin so small movements do not change the tree, a moved entity is only reinserted once it leaves its grown bounds.
+	/// The tree is kept balanced with rotations, so queries and changes visit a logarithmic amount of nodes.
+	/// </summary>
+	class ACID_EXPORT BoundingTree
+	{
+	private:
+		struct Node
+		{
+			Aabb m_bounds;
+			Entity *m_entity;
+			uint32_t m_parent;
+			uint32_t m_left;
+			uint32_t m_right;
+			int32_t m_height;
+
+			bool IsLeaf() const { return m_left == NULL_NODE; }
+		};
+
+		std::vector<Node> m_nodes;
+		uint32_t m_root;
+		uint32_t m_free;
+		uint32_t m_size;
+	public:
+		/// <summary>
+		/// The index used for no node.
+		/// </summary>
+		static const uint32_t NULL_NODE;
+
+		/// <summary>
+		/// The distance leaf bounds are grown by.
+		/// </summary>
+		static const float MARGIN;
+
+		/// <summary>
+		/// Creates a new empty bounding tree.
+		/// </summary>
+		BoundingTree();
+
+		/// <summary>
+		/// Adds a entity into the tree.
+		/// </summary>
+		/// <param name="entity"> The entity. </param>
+		/// <param name="bounds"> The entities world bounds. </param>
+		/// <returns> The leaf holding the entity. </returns>
+		uint32_t Insert(Entity *entity, const Aabb &bounds);
+
+		/// <summary>
+		/// Removes a entity from the tree.
+		/// </summary>
+		/// <param name="leaf"> The leaf holding the entity. </param>
+		void Remove(const uint32_t &leaf);
+
+		/// <summary>
+		/// Moves a entity in the tree, nothing changes while the new bounds are inside the leafs grown bounds.
+		/// </summary>
+		/// <param name="leaf"> The leaf holding the entity. </param>
+		/// <param name="bounds"> The entities new world bounds. </param>
+		/// <returns> If the entity was reinserted. </returns>
+		bool Update(const uint32_t &leaf, const Aabb &bounds);
+
+		/// <summary>
+		/// Removes every entity from the tree.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Calls a function with every entity in a leaf that passes a test, children are only visited if their parent passes.
+		/// The test must pass for any bounds containing bounds it passes for, like a overlap test.
+		/// </summary>
+		/// <param name="test"> The test, given the bounds of a node. </param>
+		/// <param name="function"> The function, given each entity found. </param>
+		template<typename T, typename F>
+		void Query(T &&test, F &&function) const
+		{
+			if (m_root == NULL_NODE)
+			{
+				return;
+			}
+
+			std::vector<uint32_t> stack;
+			stack.reserve(64);
+			stack.emplace_back(m_root);
+
+			while (!stack.empty())
+			{
+				auto &node = m_nodes[stack.back()];
+				stack.pop_back();
+
+				if (!test(node.m_bounds))
+				{
+					continue;
+				}
+
+				if (node.IsLeaf())
+				{
+					function(node.m_entity);
+					continue;
+				}
+
+				stack.emplace_back(node.m_left);
+				stack.emplace_back(node.m_right);
+			}
+		}
+
+		/// <summary>
+		/// Gets the grown bounds of a leaf.
+		/// </summary>
+		/// <param name="leaf"> The leaf. </param>
+		/// <returns> The leaf bounds. </returns>
+		const Aabb &GetBounds(const uint32_t &leaf) const { return m_nodes[leaf].m_bounds; }
+
+		/// <summary>
+		/// Gets the amount of entities in the tree.
+		/// </summary>
+		/// <returns> The entity count. </returns>
+		uint32_t GetSize() const { return m_size; }
+
+		/// <summary>
+		/// Gets the longest path from the root to a leaf.
+		/// </summary>
+		/// <returns> The tree height. </returns>
+		uint32_t GetHeight() const { return m_root == NULL_NODE ? 0 : static_cast<uint32_t>(m_nodes[m_root].m_height); }
+	private:
+		uint32_t AllocateNode();
+
+		void FreeNode(const uint32_t &node);
+
+		void InsertLeaf(const uint32_t &leaf);
+
+		void RemoveLeaf(const uint32_t &leaf);
+
+		/// <summary>
+		/// Refits the bounds and heights from a node up to the root, rotating unbalanced nodes.
+		/// </summary>
+		/// <param name="node"> The first node to refit. </param>
+		void Refit(uint32_t node);
+
+		/// <summary>
+		/// Rotates a child up if one side of a node is more than one level taller than the other.
+		/// </summary>
+		/// <param name="node"> The node to balance. </param>
+		/// <returns> The node now in its place. </returns>
+		uint32_t Balance(const uint32_t &node);
+
+		/// <summary>
+		/// Rotates a child of a node up into its place.
+		/// </summary>
+		/// <param name="node"> The node moving down. </param>
+		/// <param name="child"> The taller child moving up. </param>
+		/// <returns> The child. </returns>
+		uint32_t Rotate(const uint32_t &node, const uint32_t &child);
+	};
+}
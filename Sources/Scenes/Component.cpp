@@ -0,0 +1,60 @@
+#include "Component.hpp"
+
+#include <algorithm>
+#include "Memory/BlockPool.hpp"
+
+namespace acid
+{
+	static const std::size_t POOL_GRANULARITY = 16;
+	static const std::size_t POOL_MAX_SIZE = 1024;
+
+	static BlockPool *GetPool(const std::size_t &size)
+	{
+		// Pools live until exit, components held by statics may be destroyed after this would have been.
+		static auto pools = []()
+		{
+			auto pools = new BlockPool *[POOL_MAX_SIZE / POOL_GRANULARITY];
+
+			for (std::size_t i = 0; i < POOL_MAX_SIZE / POOL_GRANULARITY; i++)
+			{
+				pools[i] = new BlockPool((i + 1) * POOL_GRANULARITY);
+			}
+
+			return pools;
+		}();
+		return pools[(size - 1) / POOL_GRANULARITY];
+	}
+
+	void Component::SetUpdateRate(const UpdateRate &updateRate, const uint32_t &updateInterval, const float &updateDistance)
+	{
+		m_updateRate = updateRate;
+		m_updateInterval = std::max(updateInterval, 1u);
+		m_updateDistance = updateDistance;
+	}
+
+	void *Component::operator new(std::size_t size)
+	{
+		if (size == 0 || size > POOL_MAX_SIZE)
+		{
+			return ::operator new(size);
+		}
+
+		return GetPool(size)->Allocate();
+	}
+
+	void Component::operator delete(void *pointer, std::size_t size)
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		if (size == 0 || size > POOL_MAX_SIZE)
+		{
+			::operator delete(pointer);
+			return;
+		}
+
+		GetPool(size)->Deallocate(pointer);
+	}
+}
@@ -1,12 +1,28 @@
 #pragma once
 
+#include <cstddef>
+#include <new>
+#include <optional>
 #include "Engine/Exports.hpp"
+#include "Maths/Time.hpp"
+#include "Physics/Aabb.hpp"
 #include "Serialized/Metadata.hpp"
 
 namespace acid
 {
 	class Entity;
 
+	/// <summary>
+	/// How often a component is updated by its entity, components updated less than every tick are spread evenly over the ticks between updates.
+	/// </summary>
+	enum UpdateRate
+	{
+		UPDATE_RATE_ALWAYS = 0,
+		UPDATE_RATE_INTERVAL = 1,
+		UPDATE_RATE_DISTANCE = 2,
+		UPDATE_RATE_NEVER = 3
+	};
+
 	/// <summary>
 	/// A class that represents a functional component attached to entity.
 	/// </summary>
@@ -19,15 +35,31 @@ namespace acid
 		bool m_enabled;
 		bool m_removed;
 		Entity *m_parent;
+		uint32_t m_typeId;
+		UpdateRate m_updateRate;
+		uint32_t m_updateInterval;
+		float m_updateDistance;
+		uint32_t m_updatePhase;
+		Time m_updateTime;
+		Time m_updateDelta;
 	public:
 		explicit Component() :
 			m_started(false),
 			m_enabled(true),
 			m_removed(false),
-			m_parent(nullptr)
+			m_parent(nullptr),
+			m_typeId(0),
+			m_updateRate(UPDATE_RATE_ALWAYS),
+			m_updateInterval(1),
+			m_updateDistance(10.0f),
+			m_updatePhase(0),
+			m_updateTime(Time::ZERO),
+			m_updateDelta(Time::ZERO)
 		{
 		}
 
+		virtual ~Component() = default;
+
 		/// <summary>
 		/// Run when starting the component if <seealso cref="#m_started"/> is false.
 		/// </summary>
@@ -36,10 +68,12 @@ namespace acid
 		}
 
 		/// <summary>
-		/// Run when updating the entity this is attached to.
+		/// Run when updating the entity this is attached to, as often as the update rate allows.
+		/// Components that do not override this are not updated again.
 		/// </summary>
 		virtual void Update()
 		{
+			m_updateRate = UPDATE_RATE_NEVER;
 		}
 
 		/// <summary>
@@ -58,6 +92,15 @@ namespace acid
 		{
 		}
 
+		/// <summary>
+		/// Gets the world space bounds of this component, entities are placed in the structures bounding tree by the bounds of their components.
+		/// </summary>
+		/// <returns> The bounds, or nothing if this component has no size. </returns>
+		virtual std::optional<Aabb> GetBounds() const
+		{
+			return {};
+		}
+
 		bool IsEnabled() const { return m_enabled; };
 
 		void SetEnabled(const bool &enable) { m_enabled = enable; }
@@ -66,6 +109,26 @@ namespace acid
 
 		void SetRemoved(const bool &removed) { m_removed = removed; }
 
+		UpdateRate GetUpdateRate() const { return m_updateRate; }
+
+		uint32_t GetUpdateInterval() const { return m_updateInterval; }
+
+		float GetUpdateDistance() const { return m_updateDistance; }
+
+		/// <summary>
+		/// Sets how often this component is updated.
+		/// </summary>
+		/// <param name="updateRate"> The update rate. </param>
+		/// <param name="updateInterval"> The ticks between updates, or with a distance rate the most ticks between updates. </param>
+		/// <param name="updateDistance"> With a distance rate, the distance from the camera that adds a tick between updates. </param>
+		void SetUpdateRate(const UpdateRate &updateRate, const uint32_t &updateInterval = 1, const float &updateDistance = 10.0f);
+
+		/// <summary>
+		/// Gets the time since this component was last updated, components not updated every tick should use this over the engine delta.
+		/// </summary>
+		/// <returns> The time since the last update, zero for the first update. </returns>
+		const Time &GetUpdateDelta() const { return m_updateDelta; }
+
 		/// <summary>
 		/// Gets the entity this component is attached to.
 		/// </summary>
@@ -77,5 +140,30 @@ namespace acid
 		/// </summary>
 		/// <param name="parent"> The new parent this is attached to. </param>
 		void SetParent(Entity *parent) { m_parent = parent; }
+
+		/// <summary>
+		/// Components are allocated from pools of same sized blocks, so components of a type created together sit next to each other in memory.
+		/// </summary>
+		/// <param name="size"> The size of the component type. </param>
+		/// <returns> The allocated memory. </returns>
+		static void *operator new(std::size_t size);
+
+		static void *operator new(std::size_t size, std::align_val_t alignment) { return ::operator new(size, alignment); }
+
+		static void *operator new(std::size_t size, void *place) noexcept { return place; }
+
+		static void operator delete(void *pointer, std::size_t size);
+
+		static void operator delete(void *pointer, std::size_t size, std::align_val_t alignment) { ::operator delete(pointer, size, alignment); }
+
+		static void operator delete(void *pointer, void *place) noexcept
+		{
+		}
+
+		/// <summary>
+		/// Gets the type id of this components type, set when it is added to a entity.
+		/// </summary>
+		/// <returns> The type id. </returns>
+		uint32_t GetTypeId() const { return m_typeId; }
 	};
 }
@@ -20,12 +20,14 @@
 #include "Physics/Rigidbody.hpp"
 #include "Shadows/ShadowRender.hpp"
 #include "Skyboxes/MaterialSkybox.hpp"
+#include "TransformComponent.hpp"
 
 namespace acid
 {
 	ComponentRegister::ComponentRegister() :
 		m_mutex(std::mutex()),
-		m_components(std::map<std::string, ComponentCreate>())
+		m_components(std::unordered_map<std::string, ComponentCreate>()),
+		m_names(std::unordered_map<uint32_t, std::string>())
 	{
 		Add<ColliderCapsule>("ColliderCapsule");
 		Add<ColliderCone>("ColliderCone");
@@ -48,13 +50,22 @@ namespace acid
 		Add<ParticleSystem>("ParticleSystem");
 		Add<Rigidbody>("Rigidbody");
 		Add<ShadowRender>("ShadowRender");
+		Add<TransformComponent>("TransformComponent");
 	}
 
 	void ComponentRegister::Remove(const std::string &name)
 	{
 		std::lock_guard<std::mutex> lock(m_mutex);
 
-		m_components.erase(name);
+		auto it = m_components.find(name);
+
+		if (it == m_components.end())
+		{
+			return;
+		}
+
+		m_names.erase((*it).second.m_typeId);
+		m_components.erase(it);
 	}
 
 	Component *ComponentRegister::Create(const std::string &name) const
@@ -70,18 +81,57 @@ namespace acid
 		return ((*it).second).m_create();
 	}
 
+	std::function<Component *(const Component *)> ComponentRegister::FindClone(const std::string &name) const
+	{
+		auto it = m_components.find(name);
+
+		if (it == m_components.end())
+		{
+			return {};
+		}
+
+		if (((*it).second).m_clone == nullptr)
+		{
+			return {};
+		}
+
+		return ((*it).second).m_clone;
+	}
+
 	std::optional<std::string> ComponentRegister::FindName(Component *compare) const
 	{
-		// TODO: Replace with std::remove_if when it can be used with maps.
+		// Components in a entity already know their type id, others are looked up by their type.
+		auto typeId = compare->GetParent() != nullptr ? compare->GetTypeId() : Entity::GetTypeId(typeid(*compare));
+		auto it = m_names.find(typeId);
+
+		if (it != m_names.end())
+		{
+			return (*it).second;
+		}
+
+		// Only types that were never registered are searched for, the first name in order is used when more than one type matches.
+		std::optional<std::string> result;
 
 		for (auto &[name, component] : m_components)
 		{
-			if (component.m_isSame(compare))
+			if (component.m_isSame(compare) && (!result || name < *result))
 			{
-				return name;
+				result = name;
 			}
 		}
 
-		return {};
+		return result;
+	}
+
+	std::optional<uint32_t> ComponentRegister::FindTypeId(const std::string &name) const
+	{
+		auto it = m_components.find(name);
+
+		if (it == m_components.end())
+		{
+			return {};
+		}
+
+		return ((*it).second).m_typeId;
 	}
 }
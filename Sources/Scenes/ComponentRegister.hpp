@@ -4,25 +4,32 @@
 #include <mutex>
 #include <memory>
 #include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
 #include "Engine/Log.hpp"
 #include "Component.hpp"
+#include "Entity.hpp"
 
 namespace acid
 {
 	/// <summary>
-	/// A class that holds registered components.
+	/// A class that holds registered components, found by name or by the type id of a component.
 	/// </summary>
 	class ACID_EXPORT ComponentRegister
 	{
 	private:
 		struct ComponentCreate
 		{
-			std::function<Component *()> m_create;
-			std::function<bool(Component *)> m_isSame;
+			uint32_t m_typeId;
+			Component *(*m_create)();
+			Component *(*m_clone)(const Component *);
+			bool (*m_isSame)(Component *);
 		};
 
 		std::mutex m_mutex;
-		std::map<std::string, ComponentCreate> m_components;
+		std::unordered_map<std::string, ComponentCreate> m_components;
+		std::unordered_map<uint32_t, std::string> m_names;
 	public:
 		/// <summary>
 		/// Creates a new component register.
@@ -39,23 +46,36 @@ namespace acid
 		{
 			std::lock_guard<std::mutex> lock(m_mutex);
 
-			if (m_components.find(name) != m_components.end())
+			auto typeId = Entity::GetTypeId<T>();
+
+			if (m_components.find(name) != m_components.end() || m_names.find(typeId) != m_names.end())
 			{
 				Log::Error("Component '%s' is already registered!\n", name.c_str());
 				return;
 			}
 
+			// Created components come from the pools in Component::operator new.
 			ComponentCreate componentCreate = {};
+			componentCreate.m_typeId = typeId;
 			componentCreate.m_create = []() -> Component *
 			{
 				return new T();
 			};
+
+			if constexpr (std::is_copy_constructible_v<T>)
+			{
+				componentCreate.m_clone = [](const Component *component) -> Component *
+				{
+					return new T(*static_cast<const T *>(component));
+				};
+			}
 			componentCreate.m_isSame = [](Component *component) -> bool
 			{
 				return dynamic_cast<T *>(component) != nullptr;
 			};
 
 			m_components.emplace(name, componentCreate);
+			m_names.emplace(typeId, name);
 		}
 
 		/// <summary>
@@ -72,10 +92,24 @@ namespace acid
 		Component *Create(const std::string &name) const;
 
 		/// <summary>
-		/// Finds the registered name to a component.
+		/// Finds the function that copies a component of a registered type, types that can not be copy constructed have none.
+		/// </summary>
+		/// <param name="name"> The component name. </param>
+		/// <returns> The copy function, or a empty function. </returns>
+		std::function<Component *(const Component *)> FindClone(const std::string &name) const;
+
+		/// <summary>
+		/// Finds the registered name to a component, a component of a type that was not registered is named by the registered type it derives from.
 		/// </summary>
 		/// <param name="compare"> The components to get the registered name of. </param>
 		/// <returns> The name registered to the component. </returns>
 		std::optional<std::string> FindName(Component *compare) const;
+
+		/// <summary>
+		/// Finds the type id of a registered component.
+		/// </summary>
+		/// <param name="name"> The component name. </param>
+		/// <returns> The type id, see <seealso cref="Entity#GetTypeId"/>. </returns>
+		std::optional<uint32_t> FindTypeId(const std::string &name) const;
 	};
 }
@@ -1,19 +1,36 @@
 #include "Entity.hpp"
 
-#include "Helpers/FileSystem.hpp"
+#include <algorithm>
+#include "Helpers/TypeIds.hpp"
+#include "Memory/BlockPool.hpp"
 #include "Scenes.hpp"
 #include "EntityPrefab.hpp"
+#include "SceneStructure.hpp"
 
 namespace acid
 {
 	Entity::Entity(const Transform &transform) :
 		m_name(""),
 		m_localTransform(transform),
-		m_mutex(std::mutex()),
+		m_worldTransform(transform),
+		m_transformIndex(TransformHierarchy::NULL_INDEX),
 		m_components(std::vector<std::unique_ptr<Component>>()),
+		m_indexMutex(std::mutex()),
+		m_indices(std::array<ComponentIndex, 16>()),
+		m_indexCount(0),
 		m_parent(nullptr),
 		m_children(std::vector<Entity *>()),
-		m_removed(false)
+		m_removed(false),
+		m_structure(nullptr),
+		m_handle(EntityHandle()),
+		m_objectIndex(0),
+		m_archetype(nullptr),
+		m_archetypeRow(0),
+		m_archetypeDirty(false),
+		m_dirtyIndex(0),
+		m_boundsNode(BoundingTree::NULL_NODE),
+		m_bounds(Aabb()),
+		m_boundsDirty(true)
 	{
 	}
 
@@ -22,142 +39,294 @@ namespace acid
 	{
 		auto prefabObject = EntityPrefab::Create(filename);
 
-		for (auto &value : prefabObject->GetParent()->GetChildren())
+		if (prefabObject != nullptr)
 		{
-			if (value->GetName().empty())
-			{
-				continue;
-			}
+			prefabObject->Instantiate(*this);
+		}
+	}
 
-			auto component = Scenes::Get()->GetComponentRegister().Create(value->GetName());
+	Entity::~Entity()
+	{
+		if (m_parent != nullptr)
+		{
+			m_parent->RemoveChild(this);
+		}
 
-			if (component == nullptr)
-			{
-				continue;
-			}
+		for (auto &child : m_children)
+		{
+			child->m_parent = nullptr;
+		}
+	}
 
-			component->Decode(*value);
-			AddComponent(component);
+	static uint32_t GetUpdatePhase(const uint32_t &typeId)
+	{
+		static std::mutex mutex;
+		static std::vector<uint32_t> phases;
+
+		// Phases are given out in turn for each type, so components of a type with the same rate are spread evenly over its ticks.
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (typeId >= phases.size())
+		{
+			phases.resize(typeId + 1);
 		}
 
-		m_name = FileSystem::FileName(filename);
+		return phases[typeId]++;
 	}
 
-	Entity::~Entity()
+	static BlockPool *GetPool()
 	{
-		if (m_parent != nullptr)
+		// The pool lives until exit, entities held by statics may be destroyed after this would have been.
+		static auto pool = new BlockPool(sizeof(Entity), 256);
+		return pool;
+	}
+
+	void *Entity::operator new(std::size_t size)
+	{
+		if (size != sizeof(Entity))
 		{
-			m_parent->RemoveChild(this);
+			return ::operator new(size);
+		}
+
+		return GetPool()->Allocate();
+	}
+
+	void Entity::operator delete(void *pointer, std::size_t size)
+	{
+		if (pointer == nullptr)
+		{
+			return;
+		}
+
+		if (size != sizeof(Entity))
+		{
+			::operator delete(pointer);
+			return;
 		}
+
+		GetPool()->Deallocate(pointer);
 	}
 
 	void Entity::Update()
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		// Entities outside a structure are not ticked, all of their components are updated.
+		auto time = m_structure != nullptr ? m_structure->m_tickTime : Engine::GetTime();
+		std::optional<float> viewDistance;
 
-		for (auto it = m_components.begin(); it != m_components.end();)
+		// Components added by a updating component are appended, so they are updated this frame too.
+		for (uint32_t i = 0; i < m_components.size();)
 		{
-			if ((*it)->IsRemoved())
+			auto component = m_components[i].get();
+
+			if (component->IsRemoved())
 			{
-				it = m_components.erase(it);
+				Scenes::WaitFrame();
+				m_components.erase(m_components.begin() + i);
+				OnComponentsChanged();
 				continue;
 			}
 
-			if ((*it)->GetParent() != this)
+			if (component->GetParent() != this)
 			{
-				(*it)->SetParent(this);
+				component->SetParent(this);
 			}
 
-			if ((*it)->IsEnabled())
+			if (component->IsEnabled())
 			{
-				if (!(*it)->m_started)
+				if (!component->m_started)
 				{
-					(*it)->Start();
-					(*it)->m_started = true;
+					component->Start();
+					component->m_started = true;
+					m_boundsDirty = true;
 				}
 
-				(*it)->Update();
+				if (IsUpdateDue(*component, viewDistance))
+				{
+					component->m_updateDelta = component->m_updateTime == Time::ZERO ? Time::ZERO : time - component->m_updateTime;
+					component->m_updateTime = time;
+					component->Update();
+				}
 			}
 
-			++it;
+			i++;
 		}
 	}
 
 	Component *Entity::AddComponent(Component *component)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-
 		if (component == nullptr)
 		{
 			return nullptr;
 		}
 
 		component->SetParent(this);
+		component->m_typeId = GetTypeId(typeid(*component));
+		component->m_updatePhase = GetUpdatePhase(component->m_typeId);
 		m_components.emplace_back(component);
+		OnComponentsChanged();
 		return component;
 	}
 
 	void Entity::RemoveComponent(Component *component)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-
 		for (auto it = m_components.begin(); it != m_components.end(); ++it)
 		{
 			if ((*it).get() == component)
 			{
 				(*it)->SetParent(nullptr);
 
+				Scenes::WaitFrame();
 				m_components.erase(it);
+				OnComponentsChanged();
+				return;
 			}
 		}
 	}
 
 	void Entity::RemoveComponent(const std::string &name)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		auto &componentRegister = Scenes::Get()->GetComponentRegister();
 
-		for (auto it = m_components.begin(); it != m_components.end(); ++it)
+		for (auto it = m_components.begin(); it != m_components.end();)
 		{
-			auto componentName = Scenes::Get()->GetComponentRegister().FindName((*it).get());
+			auto componentName = componentRegister.FindName((*it).get());
 
-			if (componentName && name == *componentName)
+			if (!componentName || name != *componentName)
 			{
+				++it;
 				continue;
 			}
 
 			(*it)->SetParent(nullptr);
 
-			m_components.erase(it);
+			Scenes::WaitFrame();
+			it = m_components.erase(it);
+			OnComponentsChanged();
 		}
 	}
 
 	Transform Entity::GetWorldTransform() const
 	{
-		if (m_localTransform.IsDirty())
+		if (!IsTransformStale())
+		{
+			return m_worldTransform;
+		}
+
+		Matrix4 worldMatrix;
+		return CalculateWorldTransform(worldMatrix);
+	}
+
+	Matrix4 Entity::GetWorldMatrix() const
+	{
+		if (!IsTransformStale())
 		{
-			if (m_parent != nullptr)
+			return m_structure->GetTransformHierarchy().GetWorldMatrix(m_transformIndex);
+		}
+
+		Matrix4 worldMatrix;
+		CalculateWorldTransform(worldMatrix);
+		return worldMatrix;
+	}
+
+	Aabb Entity::GetBounds() const
+	{
+		Aabb result = Aabb();
+
+		for (auto &component : m_components)
+		{
+			auto bounds = component->GetBounds();
+
+			if (bounds)
 			{
-				m_worldTransform = m_parent->GetWorldTransform() * m_localTransform;
+				result = result.Union(*bounds);
 			}
-			else
+		}
+
+		if (result.IsEmpty())
+		{
+			auto position = GetWorldTransform().GetPosition();
+			return Aabb(position, position);
+		}
+
+		return result;
+	}
+
+	bool Entity::IsUpdateDue(const Component &component, std::optional<float> &viewDistance) const
+	{
+		uint32_t interval;
+
+		switch (component.m_updateRate)
+		{
+		case UPDATE_RATE_ALWAYS:
+			return true;
+		case UPDATE_RATE_INTERVAL:
+			interval = component.m_updateInterval;
+			break;
+		case UPDATE_RATE_DISTANCE:
+			if (m_structure == nullptr || !m_structure->m_viewPosition)
 			{
-				m_worldTransform = m_localTransform;
+				return true;
 			}
 
-			for (auto &child : m_children)
+			// Found once for all components of the entity, and only if one of them needs it.
+			if (!viewDistance)
 			{
-				child->m_localTransform.SetDirty(true);
+				viewDistance = GetWorldTransform().GetPosition().Distance(*m_structure->m_viewPosition);
 			}
 
-			m_localTransform.SetDirty(false);
+			interval = static_cast<uint32_t>(std::min(static_cast<float>(component.m_updateInterval), 1.0f + *viewDistance / component.m_updateDistance));
+			break;
+		default:
+			return false;
+		}
+
+		if (m_structure == nullptr || interval <= 1)
+		{
+			return true;
 		}
 
-		return m_worldTransform;
+		return (m_structure->m_tick + component.m_updatePhase) % interval == 0;
 	}
 
-	Matrix4 Entity::GetWorldMatrix() const
+	bool Entity::IsTransformStale() const
 	{
-		return GetWorldTransform().GetWorldMatrix();
+		for (auto entity = this; entity != nullptr; entity = entity->m_parent)
+		{
+			if (entity->m_structure == nullptr || entity->m_structure != m_structure || entity->m_transformIndex == TransformHierarchy::NULL_INDEX ||
+				entity->m_localTransform.IsDirty())
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	Transform Entity::CalculateWorldTransform(Matrix4 &worldMatrix) const
+	{
+		auto localMatrix = m_localTransform.GetWorldMatrix();
+
+		if (m_parent == nullptr)
+		{
+			worldMatrix = localMatrix;
+			return m_localTransform;
+		}
+
+		Matrix4 parentMatrix;
+		Transform parentTransform;
+
+		if (m_parent->IsTransformStale())
+		{
+			parentTransform = m_parent->CalculateWorldTransform(parentMatrix);
+		}
+		else
+		{
+			parentTransform = m_parent->m_worldTransform;
+			parentMatrix = m_parent->GetWorldMatrix();
+		}
+
+		worldMatrix = parentMatrix * localMatrix;
+		return parentTransform * m_localTransform;
 	}
 
 	void Entity::SetParent(Entity *parent)
@@ -173,6 +342,14 @@ namespace acid
 		{
 			m_parent->AddChild(this);
 		}
+
+		// The hierarchy sorts again and calculates this entity and its children, until then they are calculated when read.
+		m_localTransform.SetDirty(true);
+
+		if (m_structure != nullptr)
+		{
+			m_structure->GetTransformHierarchy().Invalidate();
+		}
 	}
 
 	void Entity::AddChild(Entity *child)
@@ -184,4 +361,76 @@ namespace acid
 	{
 		m_children.erase(std::remove(m_children.begin(), m_children.end(), child), m_children.end());
 	}
+
+	uint32_t Entity::GetTypeId(const std::type_index &type)
+	{
+		return TypeIds::Get(typeid(Component), type);
+	}
+
+	std::optional<uint64_t> Entity::FindComponents(const uint32_t &typeId, bool (*matches)(Component *)) const
+	{
+		// Components past the bits of the mask are not indexed.
+		if (m_components.size() > 64)
+		{
+			return {};
+		}
+
+		// Indices are only ever appended until cleared, so published entries can be read without locking.
+		uint32_t count = m_indexCount.load(std::memory_order_acquire);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (m_indices[i].m_typeId == typeId)
+			{
+				return m_indices[i].m_mask;
+			}
+		}
+
+		std::lock_guard<std::mutex> lock(m_indexMutex);
+		count = m_indexCount.load(std::memory_order_relaxed);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			if (m_indices[i].m_typeId == typeId)
+			{
+				return m_indices[i].m_mask;
+			}
+		}
+
+		uint64_t mask = 0;
+
+		for (size_t i = 0; i < m_components.size(); i++)
+		{
+			auto component = m_components[i].get();
+
+			if (component->m_typeId == typeId || matches(component))
+			{
+				mask |= uint64_t(1) << i;
+			}
+		}
+
+		// When every entry is taken the mask is still correct, it is just found again next time.
+		if (count < m_indices.size())
+		{
+			m_indices[count] = {typeId, mask};
+			m_indexCount.store(count + 1, std::memory_order_release);
+		}
+
+		return mask;
+	}
+
+	void Entity::OnComponentsChanged()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_indexMutex);
+			m_indexCount.store(0, std::memory_order_release);
+		}
+
+		m_boundsDirty = true;
+
+		if (m_structure != nullptr)
+		{
+			m_structure->MarkDirty(this);
+		}
+	}
 }
@@ -1,28 +1,67 @@
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <typeindex>
 #include <vector>
+#if defined(ACID_BUILD_MSVC)
+#include <intrin.h>
+#endif
 #include "Engine/Exports.hpp"
 #include "Maths/Transform.hpp"
 #include "Component.hpp"
+#include "EntityHandle.hpp"
 
 namespace acid
 {
+	class Archetype;
+	class SceneStructure;
+
 	/// <summary>
 	/// A class that represents a objects that acts as a component container.
+	/// Entities are not locked, they are changed from the thread updating the scene. Other threads record changes into a <seealso cref="EntityCommandBuffer"/>.
 	/// </summary>
 	class ACID_EXPORT Entity
 	{
 	private:
+		friend class SceneStructure;
+		friend class TransformHierarchy;
+
+		/// <summary>
+		/// The components found for a type, as a bit for every matching index into the components list.
+		/// </summary>
+		struct ComponentIndex
+		{
+			uint32_t m_typeId;
+			uint64_t m_mask;
+		};
+
 		std::string m_name;
 		Transform m_localTransform;
-		mutable Transform m_worldTransform;
-		std::mutex m_mutex;
+		Transform m_worldTransform;
+		uint32_t m_transformIndex;
 		std::vector<std::unique_ptr<Component>> m_components;
+		mutable std::mutex m_indexMutex;
+		mutable std::array<ComponentIndex, 16> m_indices;
+		mutable std::atomic<uint32_t> m_indexCount;
 		Entity *m_parent;
 		std::vector<Entity *> m_children;
 		bool m_removed;
+		SceneStructure *m_structure;
+		EntityHandle m_handle;
+		uint32_t m_objectIndex;
+		Archetype *m_archetype;
+		uint32_t m_archetypeRow;
+		bool m_archetypeDirty;
+		uint32_t m_dirtyIndex;
+		uint32_t m_boundsNode;
+		Aabb m_bounds;
+		mutable bool m_boundsDirty;
 	public:
 		/// <summary>
 		/// Creates a new entity and stores it into a structure.
@@ -43,6 +82,15 @@ namespace acid
 
 		Entity& operator=(const Entity&) = delete;
 
+		/// <summary>
+		/// Entities are allocated from a pool of same sized blocks, so spawning and removing many entities does not fragment the heap.
+		/// </summary>
+		/// <param name="size"> The size of the entity. </param>
+		/// <returns> The allocated memory. </returns>
+		static void *operator new(std::size_t size);
+
+		static void operator delete(void *pointer, std::size_t size);
+
 		void Update();
 
 		/// <summary>
@@ -66,25 +114,22 @@ namespace acid
 		template<typename T>
 		T *GetComponent(const bool &allowDisabled = false) const
 		{
+			T *result = nullptr;
 			T *alternative = nullptr;
 
-			for (auto &component : m_components)
+			ForEachComponent<T>([&](T *casted)
 			{
-				auto casted = dynamic_cast<T *>(component.get());
-
-				if (casted != nullptr)
+				if (allowDisabled && !casted->IsEnabled())
 				{
-					if (allowDisabled && !casted->IsEnabled())
-					{
-						alternative = casted;
-						continue;
-					}
-
-					return casted;
+					alternative = casted;
+					return true;
 				}
-			}
 
-			return alternative;
+				result = casted;
+				return false;
+			});
+
+			return result != nullptr ? result : alternative;
 		}
 
 		/// <summary>
@@ -98,21 +143,11 @@ namespace acid
 		{
 			std::vector<T *> result = {};
 
-			for (auto &component : m_components)
+			ForEachComponent<T>([&](T *casted)
 			{
-				auto casted = dynamic_cast<T *>(component.get());
-
-				if (casted != nullptr)
-				{
-					if (allowDisabled && !casted->IsEnabled())
-					{
-						result.emplace_back(casted);
-						continue;
-					}
-
-					result.emplace_back(casted);
-				}
-			}
+				result.emplace_back(casted);
+				return true;
+			});
 
 			return result;
 		}
@@ -160,19 +195,21 @@ namespace acid
 		template<typename T>
 		void RemoveComponent()
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
+			// Removed through the pointer overload, so the frame in flight is waited on before a component is freed.
+			std::vector<Component *> removing = {};
 
-			for (auto it = m_components.begin(); it != m_components.end(); ++it)
+			for (auto &component : m_components)
 			{
-				auto casted = dynamic_cast<T *>((*it).get());
-
-				if (casted != nullptr)
+				if (dynamic_cast<T *>(component.get()) != nullptr)
 				{
-					(*it)->SetParent(nullptr);
-
-					m_components.erase(it);
+					removing.emplace_back(component.get());
 				}
 			}
+
+			for (auto &component : removing)
+			{
+				RemoveComponent(component);
+			}
 		}
 
 		std::string GetName() const { return m_name; }
@@ -183,10 +220,35 @@ namespace acid
 
 		void SetLocalTransform(const Transform &localTransform) { m_localTransform = localTransform; }
 
+		/// <summary>
+		/// Gets the world transform, as calculated by the structures transform hierarchy unless this entity or a parent moved since.
+		/// </summary>
+		/// <returns> The world transform. </returns>
 		Transform GetWorldTransform() const;
 
+		/// <summary>
+		/// Gets the world matrix, as calculated by the structures transform hierarchy unless this entity or a parent moved since.
+		/// </summary>
+		/// <returns> The world matrix. </returns>
 		Matrix4 GetWorldMatrix() const;
 
+		/// <summary>
+		/// Gets the world space bounds of this entity, the bounds of its components or its position if none have bounds.
+		/// </summary>
+		/// <returns> The world bounds. </returns>
+		Aabb GetBounds() const;
+
+		/// <summary>
+		/// Marks the bounds of this entity as changed, for components whose bounds change without the entity moving.
+		/// </summary>
+		void SetBoundsDirty() { m_boundsDirty = true; }
+
+		/// <summary>
+		/// Gets the handle of this entity in its structure, a handle can be kept and checked after this entity has been removed.
+		/// </summary>
+		/// <returns> The handle, or a null handle if this entity is not in a structure. </returns>
+		const EntityHandle &GetHandle() const { return m_handle; }
+
 		bool IsRemoved() const { return m_removed; }
 
 		void SetRemoved(const bool &removed) { m_removed = removed; }
@@ -200,5 +262,119 @@ namespace acid
 		void AddChild(Entity *child);
 
 		void RemoveChild(Entity *child);
+
+		/// <summary>
+		/// Gets a small unique id for a component type, used to index components by type.
+		/// </summary>
+		/// <param name="type"> The type. </param>
+		/// <returns> The type id. </returns>
+		static uint32_t GetTypeId(const std::type_index &type);
+
+		/// <summary>
+		/// Gets a small unique id for a component type, used to index components by type.
+		/// </summary>
+		/// <param name="T"> The type. </param>
+		/// <returns> The type id. </returns>
+		template<typename T>
+		static uint32_t GetTypeId()
+		{
+			static const uint32_t typeId = GetTypeId(typeid(T));
+			return typeId;
+		}
+	private:
+		/// <summary>
+		/// Gets if a component is due to be updated this tick.
+		/// </summary>
+		/// <param name="component"> The component. </param>
+		/// <param name="viewDistance"> The distance of this entity from the view position, found when first needed. </param>
+		/// <returns> If the component should be updated. </returns>
+		bool IsUpdateDue(const Component &component, std::optional<float> &viewDistance) const;
+
+		/// <summary>
+		/// Gets if the world transform kept by the transform hierarchy is out of date.
+		/// </summary>
+		/// <returns> If this entity or a parent moved since the hierarchy was last updated. </returns>
+		bool IsTransformStale() const;
+
+		/// <summary>
+		/// Calculates the world transform and matrix from the local transforms up to the first parent that has not moved.
+		/// </summary>
+		/// <param name="worldMatrix"> The calculated world matrix. </param>
+		/// <returns> The calculated world transform. </returns>
+		Transform CalculateWorldTransform(Matrix4 &worldMatrix) const;
+
+		/// <summary>
+		/// Calls a function with every component of a type in the order they were added, until the function returns false.
+		/// Matches are found with a dynamic cast once per type and then kept until the components change.
+		/// </summary>
+		/// <param name="function"> The function to call. </param>
+		/// <param name="T"> The component type to find. </param>
+		template<typename T, typename F>
+		void ForEachComponent(F &&function) const
+		{
+			auto mask = FindComponents(GetTypeId<T>(), [](Component *component)
+			{
+				return dynamic_cast<T *>(component) != nullptr;
+			});
+
+			if (!mask)
+			{
+				for (auto &component : m_components)
+				{
+					auto casted = dynamic_cast<T *>(component.get());
+
+					if (casted != nullptr && !function(casted))
+					{
+						return;
+					}
+				}
+
+				return;
+			}
+
+			for (uint64_t bits = *mask; bits != 0; bits &= bits - 1)
+			{
+				auto component = m_components[TrailingZeros(bits)].get();
+				T *casted;
+
+				if constexpr (std::is_base_of_v<Component, T>)
+				{
+					casted = static_cast<T *>(component);
+				}
+				else
+				{
+					casted = dynamic_cast<T *>(component);
+				}
+
+				if (!function(casted))
+				{
+					return;
+				}
+			}
+		}
+
+		/// <summary>
+		/// Finds the components of a type, the result is kept in the index.
+		/// </summary>
+		/// <param name="typeId"> The type id being found. </param>
+		/// <param name="matches"> If a component is of the type. </param>
+		/// <returns> A bit for every matching component, or nothing if there are too many components to index. </returns>
+		std::optional<uint64_t> FindComponents(const uint32_t &typeId, bool (*matches)(Component *)) const;
+
+		/// <summary>
+		/// Clears the index and moves this entity to a new archetype, called when components are added or removed.
+		/// </summary>
+		void OnComponentsChanged();
+
+		static uint32_t TrailingZeros(const uint64_t &value)
+		{
+#if defined(ACID_BUILD_MSVC)
+			unsigned long index;
+			_BitScanForward64(&index, value);
+			return static_cast<uint32_t>(index);
+#else
+			return static_cast<uint32_t>(__builtin_ctzll(value));
+#endif
+		}
 	};
 }
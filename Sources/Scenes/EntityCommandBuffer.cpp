@@ -0,0 +1,218 @@
+#include "EntityCommandBuffer.hpp"
+
+#include <limits>
+#include "SceneStructure.hpp"
+
+namespace acid
+{
+	const uint32_t EntityCommandBuffer::NULL_CREATED = std::numeric_limits<uint32_t>::max();
+
+	EntityCommandBuffer::EntityCommandBuffer() :
+		m_mutex(std::mutex()),
+		m_commands(std::vector<Command>()),
+		m_created(std::vector<std::unique_ptr<Entity>>()),
+		m_createdIndices(std::unordered_map<Entity *, uint32_t>())
+	{
+	}
+
+	EntityCommandBuffer::~EntityCommandBuffer()
+	{
+		Clear();
+	}
+
+	Entity *EntityCommandBuffer::CreateEntity(const Transform &transform)
+	{
+		auto entity = new Entity(transform);
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto index = static_cast<uint32_t>(m_created.size());
+		m_createdIndices.emplace(entity, index);
+		m_created.emplace_back(entity);
+		Record(Type::Create, {EntityHandle(), index}, {EntityHandle(), NULL_CREATED}, nullptr, nullptr);
+		return entity;
+	}
+
+	void EntityCommandBuffer::DestroyEntity(Entity *entity)
+	{
+		Record(Type::Destroy, entity, nullptr, nullptr);
+	}
+
+	void EntityCommandBuffer::DestroyEntity(const EntityHandle &handle)
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		Record(Type::Destroy, {handle, NULL_CREATED}, {EntityHandle(), NULL_CREATED}, nullptr, nullptr);
+	}
+
+	Component *EntityCommandBuffer::AddComponent(Entity *entity, Component *component)
+	{
+		if (component == nullptr)
+		{
+			return nullptr;
+		}
+
+		Record(Type::AddComponent, entity, nullptr, component);
+		return component;
+	}
+
+	void EntityCommandBuffer::RemoveComponent(Entity *entity, Component *component)
+	{
+		// The component is only compared with the entities components, so it may be deleted before this is played back.
+		Record(Type::RemoveComponent, entity, nullptr, component);
+	}
+
+	void EntityCommandBuffer::SetParent(Entity *entity, Entity *parent)
+	{
+		Record(Type::SetParent, entity, parent, nullptr);
+	}
+
+	void EntityCommandBuffer::Playback(SceneStructure &structure)
+	{
+		std::vector<Command> commands;
+		std::vector<std::unique_ptr<Entity>> created;
+
+		// Taken out of the buffer first, destroying entities or components may record new commands.
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			commands.swap(m_commands);
+			created.swap(m_created);
+			m_createdIndices.clear();
+		}
+
+		// Created entities are found by the handle they are given when added, they may be destroyed again by a later command.
+		std::vector<EntityHandle> handles(created.size());
+
+		auto find = [&](const Target &target)
+		{
+			return structure.GetEntity(target.m_created != NULL_CREATED ? handles[target.m_created] : target.m_handle);
+		};
+
+		for (auto &command : commands)
+		{
+			if (command.m_type == Type::Create)
+			{
+				auto entity = created[command.m_target.m_created].get();
+				structure.Add(std::move(created[command.m_target.m_created]));
+				handles[command.m_target.m_created] = entity->GetHandle();
+				continue;
+			}
+
+			auto entity = find(command.m_target);
+
+			if (entity == nullptr)
+			{
+				if (command.m_type == Type::AddComponent)
+				{
+					delete command.m_component;
+				}
+
+				continue;
+			}
+
+			switch (command.m_type)
+			{
+			case Type::Destroy:
+				structure.Remove(entity);
+				break;
+			case Type::AddComponent:
+				entity->AddComponent(command.m_component);
+				break;
+			case Type::RemoveComponent:
+				entity->RemoveComponent(command.m_component);
+				break;
+			case Type::RemoveComponents:
+				command.m_remove(entity);
+				break;
+			case Type::SetParent:
+			{
+				auto parent = IsNull(command.m_other) ? nullptr : find(command.m_other);
+
+				// A parent that has been removed since is not replaced by no parent.
+				if (parent != nullptr || IsNull(command.m_other))
+				{
+					entity->SetParent(parent);
+				}
+
+				break;
+			}
+			default:
+				break;
+			}
+		}
+	}
+
+	void EntityCommandBuffer::Clear()
+	{
+		std::vector<Command> commands;
+		std::vector<std::unique_ptr<Entity>> created;
+
+		// Deleted after unlocking, the same as played back commands.
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			commands.swap(m_commands);
+			created.swap(m_created);
+			m_createdIndices.clear();
+		}
+
+		for (auto &command : commands)
+		{
+			if (command.m_type == Type::AddComponent)
+			{
+				delete command.m_component;
+			}
+		}
+	}
+
+	uint32_t EntityCommandBuffer::GetSize() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return static_cast<uint32_t>(m_commands.size());
+	}
+
+	bool EntityCommandBuffer::IsEmpty() const
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		return m_commands.empty();
+	}
+
+	void EntityCommandBuffer::Record(const Type &type, Entity *entity, Entity *other, Component *component, void (*remove)(Entity *))
+	{
+		std::lock_guard<std::mutex> lock(m_mutex);
+		auto target = FindTarget(entity);
+		Target otherTarget = other != nullptr ? FindTarget(other) : Target{EntityHandle(), NULL_CREATED};
+
+		// A other entity that would never be found on playback is not replaced by no entity.
+		if (other != nullptr && IsNull(otherTarget))
+		{
+			return;
+		}
+
+		Record(type, target, otherTarget, component, remove);
+	}
+
+	void EntityCommandBuffer::Record(const Type &type, const Target &target, const Target &other, Component *component, void (*remove)(Entity *))
+	{
+		// A entity in no structure, and not created by this buffer, would never be found on playback. Added components are kept to be deleted then.
+		if (type != Type::AddComponent && IsNull(target))
+		{
+			return;
+		}
+
+		m_commands.push_back({type, target, other, component, remove});
+	}
+
+	EntityCommandBuffer::Target EntityCommandBuffer::FindTarget(Entity *entity) const
+	{
+		if (entity == nullptr)
+		{
+			return {EntityHandle(), NULL_CREATED};
+		}
+
+		auto it = m_createdIndices.find(entity);
+
+		if (it != m_createdIndices.end())
+		{
+			return {EntityHandle(), it->second};
+		}
+
+		return {entity->GetHandle(), NULL_CREATED};
+	}
+}
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+#include "Engine/Exports.hpp"
+#include "Maths/Transform.hpp"
+#include "Entity.hpp"
+
+namespace acid
+{
+	class SceneStructure;
+
+	/// <summary>
+	/// A list of changes to the entities of a structure, recorded from one thread and applied later in the order they were recorded.
+	/// Entities and components are created while recording, but only join the structure when the buffer is played back,
+	/// so jobs can spawn, destroy and change entities without locking the structure or the entities they read.
+	/// Recording and playing back lock the buffer, the commands are taken out first so they are played back without it.
+	/// </summary>
+	class ACID_EXPORT EntityCommandBuffer
+	{
+	private:
+		enum class Type
+		{
+			Create, Destroy, AddComponent, RemoveComponent, RemoveComponents, SetParent
+		};
+
+		/// <summary>
+		/// A entity a command changes, either a handle into the structure or a entity created by this buffer.
+		/// </summary>
+		struct Target
+		{
+			EntityHandle m_handle;
+			uint32_t m_created;
+		};
+
+		/// <summary>
+		/// A recorded change, a added component is owned by the command until it is played back.
+		/// </summary>
+		struct Command
+		{
+			Type m_type;
+			Target m_target;
+			Target m_other;
+			Component *m_component;
+			void (*m_remove)(Entity *);
+		};
+
+		static const uint32_t NULL_CREATED;
+
+		mutable std::mutex m_mutex;
+		std::vector<Command> m_commands;
+		std::vector<std::unique_ptr<Entity>> m_created;
+		std::unordered_map<Entity *, uint32_t> m_createdIndices;
+	public:
+		/// <summary>
+		/// Creates a new empty entity command buffer.
+		/// </summary>
+		EntityCommandBuffer();
+
+		EntityCommandBuffer(const EntityCommandBuffer&) = delete;
+
+		~EntityCommandBuffer();
+
+		EntityCommandBuffer& operator=(const EntityCommandBuffer&) = delete;
+
+		/// <summary>
+		/// Creates a entity that is added to the structure on playback. Until then it is only seen by the recording thread,
+		/// so it can be changed directly or through this buffer.
+		/// </summary>
+		/// <param name="transform"> The entities initial local position, rotation, and scale. </param>
+		/// <returns> The created entity. </returns>
+		Entity *CreateEntity(const Transform &transform);
+
+		/// <summary>
+		/// Removes a entity from the structure on playback.
+		/// </summary>
+		/// <param name="entity"> The entity to remove, in the structure or created by this buffer. </param>
+		void DestroyEntity(Entity *entity);
+
+		/// <summary>
+		/// Removes a entity from the structure on playback, nothing happens if the handle no longer points to a entity by then.
+		/// </summary>
+		/// <param name="handle"> The handle of the entity to remove. </param>
+		void DestroyEntity(const EntityHandle &handle);
+
+		/// <summary>
+		/// Adds a component to a entity on playback, the component is deleted if the entity has been removed by then.
+		/// </summary>
+		/// <param name="entity"> The entity to add to. </param>
+		/// <param name="component"> The component, owned by this buffer until played back. </param>
+		/// <returns> The component. </returns>
+		Component *AddComponent(Entity *entity, Component *component);
+
+		/// <summary>
+		/// Creates a component by type now, it is added to a entity on playback.
+		/// </summary>
+		/// <param name="entity"> The entity to add to. </param>
+		/// <param name="args"> The type constructor arguments. </param>
+		/// <param name="T"> The type of component to add. </param>
+		/// <returns> The component. </returns>
+		template<typename T, typename... Args>
+		T *AddComponent(Entity *entity, Args &&... args)
+		{
+			auto created = new T(std::forward<Args>(args)...);
+			AddComponent(entity, created);
+			return created;
+		}
+
+		/// <summary>
+		/// Removes a component from a entity on playback.
+		/// </summary>
+		/// <param name="entity"> The entity to remove from. </param>
+		/// <param name="component"> The component to remove. </param>
+		void RemoveComponent(Entity *entity, Component *component);
+
+		/// <summary>
+		/// Removes the components of a type from a entity on playback.
+		/// </summary>
+		/// <param name="entity"> The entity to remove from. </param>
+		/// <param name="T"> The type of component to remove. </param>
+		template<typename T>
+		void RemoveComponent(Entity *entity)
+		{
+			Record(Type::RemoveComponents, entity, nullptr, nullptr, [](Entity *target)
+			{
+				target->RemoveComponent<T>();
+			});
+		}
+
+		/// <summary>
+		/// Changes the parent of a entity on playback.
+		/// </summary>
+		/// <param name="entity"> The entity to move. </param>
+		/// <param name="parent"> The new parent, or null to make the entity a root. </param>
+		void SetParent(Entity *entity, Entity *parent);
+
+		/// <summary>
+		/// Applies every recorded command to a structure and empties this buffer.
+		/// Commands recorded while playing back, by components being destroyed, are kept for the next playback.
+		/// </summary>
+		/// <param name="structure"> The structure the recorded entities are in. </param>
+		void Playback(SceneStructure &structure);
+
+		/// <summary>
+		/// Throws away every recorded command, created entities and components that were not played back are deleted.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Gets the amount of recorded commands.
+		/// </summary>
+		/// <returns> The command count. </returns>
+		uint32_t GetSize() const;
+
+		bool IsEmpty() const;
+	private:
+		void Record(const Type &type, Entity *entity, Entity *other, Component *component, void (*remove)(Entity *) = nullptr);
+
+		/// <summary>
+		/// Adds a command to targets that are already found, the mutex must be held.
+		/// </summary>
+		void Record(const Type &type, const Target &target, const Target &other, Component *component, void (*remove)(Entity *));
+
+		Target FindTarget(Entity *entity) const;
+
+		static bool IsNull(const Target &target) { return target.m_handle.IsNull() && target.m_created == NULL_CREATED; }
+	};
+}
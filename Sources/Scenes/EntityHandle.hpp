@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A reference to a entity in a <seealso cref="SceneStructure"/>, made of a slot index and the generation of the slot.
+	/// A slot is reused once its entity is removed, its generation then changes so old handles no longer find a entity.
+	/// </summary>
+	class ACID_EXPORT EntityHandle
+	{
+	private:
+		uint32_t m_index;
+		uint32_t m_generation;
+	public:
+		/// <summary>
+		/// Creates a new entity handle, by default one that never finds a entity.
+		/// </summary>
+		/// <param name="index"> The slot index. </param>
+		/// <param name="generation"> The generation of the slot. </param>
+		explicit EntityHandle(const uint32_t &index = std::numeric_limits<uint32_t>::max(), const uint32_t &generation = 0) :
+			m_index(index),
+			m_generation(generation)
+		{
+		}
+
+		uint32_t GetIndex() const { return m_index; }
+
+		uint32_t GetGeneration() const { return m_generation; }
+
+		/// <summary>
+		/// Gets if this handle was ever given to a entity, it may still have been removed since.
+		/// </summary>
+		/// <returns> If the handle is not the default handle. </returns>
+		bool IsNull() const { return m_index == std::numeric_limits<uint32_t>::max(); }
+
+		bool operator==(const EntityHandle &other) const { return m_index == other.m_index && m_generation == other.m_generation; }
+
+		bool operator!=(const EntityHandle &other) const { return !(*this == other); }
+	};
+}
+
+namespace std
+{
+	template<>
+	struct hash<acid::EntityHandle>
+	{
+		size_t operator()(const acid::EntityHandle &handle) const
+		{
+			return hash<uint64_t>()(static_cast<uint64_t>(handle.GetGeneration()) << 32 | handle.GetIndex());
+		}
+	};
+}
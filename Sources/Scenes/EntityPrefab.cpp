@@ -1,5 +1,6 @@
 #include "EntityPrefab.hpp"
 
+#include "Engine/Profiler.hpp"
 #include "Files/Json/FileJson.hpp"
 #include "Files/Xml/FileXml.hpp"
 #include "Helpers/FileSystem.hpp"
@@ -32,8 +33,13 @@ namespace acid
 		Resource(filename),
 		m_filename(filename),
 		m_file(nullptr),
-		m_parent(nullptr)
+		m_parent(nullptr),
+		m_compileMutex(std::mutex()),
+		m_compiled(std::vector<CompiledComponent>()),
+		m_entityName(""),
+		m_isCompiled(false)
 	{
+		ACID_PROFILE_SCOPE("EntityPrefab::Load");
 		std::string fileExt = String::Lowercase(FileSystem::FileSuffix(filename));
 
 		if (fileExt == ".json")
@@ -55,8 +61,57 @@ namespace acid
 		}
 	}
 
+	void EntityPrefab::Instantiate(Entity &entity) const
+	{
+		std::vector<Component *> components;
+		std::string name;
+
+		// Held while the components are made, Write clears the templates and the metadata they decode from.
+		{
+			std::lock_guard<std::mutex> lock(m_compileMutex);
+
+			if (!m_isCompiled)
+			{
+				Compile();
+			}
+
+			name = m_entityName;
+			components.reserve(m_compiled.size());
+
+			for (auto &compiled : m_compiled)
+			{
+				if (compiled.m_template != nullptr)
+				{
+					components.emplace_back(compiled.m_clone(compiled.m_template.get()));
+					continue;
+				}
+
+				auto component = Scenes::Get()->GetComponentRegister().Create(compiled.m_name);
+
+				if (component == nullptr)
+				{
+					continue;
+				}
+
+				component->Decode(*compiled.m_metadata);
+				components.emplace_back(component);
+			}
+		}
+
+		for (auto &component : components)
+		{
+			entity.AddComponent(component);
+		}
+
+		entity.SetName(name);
+	}
+
 	void EntityPrefab::Write(const Entity &entity)
 	{
+		std::lock_guard<std::mutex> lock(m_compileMutex);
+		m_compiled.clear();
+		m_isCompiled = false;
+
 		m_parent->ClearChildren();
 
 		for (auto &component : entity.GetComponents())
@@ -84,4 +139,47 @@ namespace acid
 	{
 		m_file->Save();
 	}
+
+	void EntityPrefab::Compile() const
+	{
+		ACID_PROFILE_SCOPE("EntityPrefab::Compile");
+		auto &componentRegister = Scenes::Get()->GetComponentRegister();
+		m_compiled.clear();
+		m_entityName = FileSystem::FileName(m_filename);
+		m_isCompiled = true;
+
+		if (m_parent == nullptr)
+		{
+			return;
+		}
+
+		for (auto &child : m_parent->GetChildren())
+		{
+			if (child->GetName().empty())
+			{
+				continue;
+			}
+
+			std::unique_ptr<Component> component(componentRegister.Create(child->GetName()));
+
+			if (component == nullptr)
+			{
+				continue;
+			}
+
+			auto clone = componentRegister.FindClone(child->GetName());
+
+			// The decoded component is only kept when it can be copied, others are decoded again for each instance.
+			if (clone)
+			{
+				component->Decode(*child);
+			}
+			else
+			{
+				component.reset();
+			}
+
+			m_compiled.push_back({child->GetName(), child.get(), std::move(component), clone});
+		}
+	}
 }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <functional>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -7,6 +9,7 @@
 #include "Files/IFile.hpp"
 #include "Helpers/String.hpp"
 #include "Resources/Resource.hpp"
+#include "Component.hpp"
 
 namespace acid
 {
@@ -19,9 +22,25 @@ namespace acid
 		public Resource
 	{
 	private:
+		/// <summary>
+		/// A component of the prefab, decoded once and then copied into every instance.
+		/// Types that can not be copied keep no template and are decoded from the metadata for each instance.
+		/// </summary>
+		struct CompiledComponent
+		{
+			std::string m_name;
+			const Metadata *m_metadata;
+			std::unique_ptr<Component> m_template;
+			std::function<Component *(const Component *)> m_clone;
+		};
+
 		std::string m_filename;
 		std::unique_ptr<IFile> m_file;
 		Metadata *m_parent;
+		mutable std::mutex m_compileMutex;
+		mutable std::vector<CompiledComponent> m_compiled;
+		mutable std::string m_entityName;
+		mutable bool m_isCompiled;
 	public:
 		/// <summary>
 		/// Will find an existing prefab object with the same filename, or create a new prefab object.
@@ -35,6 +54,13 @@ namespace acid
 		/// <param name="filename"> The file name. </param>
 		explicit EntityPrefab(const std::string &filename);
 
+		/// <summary>
+		/// Adds the components of this prefab to a entity and names it after the prefab.
+		/// The components are decoded the first time the prefab is instantiated, after that they are copied.
+		/// </summary>
+		/// <param name="entity"> The entity to add the components to. </param>
+		void Instantiate(Entity &entity) const;
+
 		void Write(const Entity &entity);
 
 		void Save();
@@ -42,5 +68,10 @@ namespace acid
 		std::string GetFilename() const { return m_filename; }
 
 		Metadata *GetParent() const { return m_parent; }
+	private:
+		/// <summary>
+		/// Decodes a template of every component in the prefab.
+		/// </summary>
+		void Compile() const;
 	};
 }
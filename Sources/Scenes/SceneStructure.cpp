@@ -1,107 +1,193 @@
 ﻿#include "SceneStructure.hpp"
 
-#include "Physics/Rigidbody.hpp"
+#include <algorithm>
+#include <limits>
+#include "EntityPrefab.hpp"
+#include "Scenes.hpp"
 
 namespace acid
 {
+	const uint32_t SceneStructure::NULL_SLOT = std::numeric_limits<uint32_t>::max();
+
 	SceneStructure::SceneStructure() :
-		m_mutex(std::mutex()),
-		m_objects(std::vector<std::unique_ptr<Entity>>())
+		m_mutex(std::recursive_mutex()),
+		m_objects(std::vector<std::unique_ptr<Entity>>()),
+		m_slots(std::vector<Slot>()),
+		m_freeSlot(NULL_SLOT),
+		m_archetypes(std::map<std::vector<uint32_t>, std::unique_ptr<Archetype>>()),
+		m_dirtyMutex(std::mutex()),
+		m_dirty(std::vector<Entity *>()),
+		m_registries(std::vector<std::unique_ptr<ComponentRegistry>>()),
+		m_tree(BoundingTree()),
+		m_transforms(TransformHierarchy()),
+		m_tick(0),
+		m_tickTime(Time::ZERO),
+		m_viewPosition(std::nullopt)
 	{
 	}
 
 	Entity *SceneStructure::CreateEntity(const Transform &transform)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
 		auto entity = new Entity(transform);
-		m_objects.emplace_back(entity);
+		Add(std::unique_ptr<Entity>(entity));
 		return entity;
 	}
 
 	Entity *SceneStructure::CreateEntity(const std::string &filename, const Transform &transform)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
 		auto entity = new Entity(filename, transform);
-		m_objects.emplace_back(entity);
+		Add(std::unique_ptr<Entity>(entity));
 		return entity;
 	}
 
+	Entity *SceneStructure::Instantiate(const EntityPrefab &prefab, const Transform &transform)
+	{
+		auto entity = new Entity(transform);
+		prefab.Instantiate(*entity);
+		Add(std::unique_ptr<Entity>(entity));
+		return entity;
+	}
+
+	std::vector<Entity *> SceneStructure::Instantiate(const EntityPrefab &prefab, const std::vector<Transform> &transforms)
+	{
+		std::vector<Entity *> result;
+		result.reserve(transforms.size());
+
+		for (auto &transform : transforms)
+		{
+			auto entity = new Entity(transform);
+			prefab.Instantiate(*entity);
+			result.emplace_back(entity);
+		}
+
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+		m_objects.reserve(m_objects.size() + result.size());
+
+		for (auto &entity : result)
+		{
+			Add(std::unique_ptr<Entity>(entity));
+		}
+
+		return result;
+	}
+
 	void SceneStructure::Add(Entity *object)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
-		m_objects.emplace_back(object);
+		Add(std::unique_ptr<Entity>(object));
 	}
 
 	void SceneStructure::Add(std::unique_ptr<Entity> object)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+		Attach(object.get());
 		m_objects.emplace_back(std::move(object));
 	}
 
 	bool SceneStructure::Remove(Entity *object)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-		for (auto it = --m_objects.end(); it != m_objects.begin(); --it)
+		if (!Contains(object))
 		{
-			if ((*it).get() != object)
-			{
-				continue;
-			}
-
-			m_objects.erase(it);
-			return true;
+			return false;
 		}
 
-		return false;
+		Scenes::WaitFrame();
+		auto index = object->m_objectIndex;
+		Detach(object);
+		TakeObject(index);
+		return true;
+	}
+
+	bool SceneStructure::Remove(const EntityHandle &handle)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+		auto object = GetEntity(handle);
+		return object != nullptr && Remove(object);
 	}
 
 	bool SceneStructure::Move(Entity *object, SceneStructure &structure)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::unique_ptr<Entity> taken;
 
-		for (auto it = --m_objects.end(); it != m_objects.begin(); --it)
+		// Only one structure is locked at a time, so moves between two structures in opposite directions can not deadlock.
 		{
-			if ((*it).get() != object)
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+			if (!Contains(object))
 			{
-				continue;
+				return false;
 			}
 
-			structure.Add(std::move(*it));
-			m_objects.erase(it);
-			return true;
+			auto index = object->m_objectIndex;
+			Detach(object);
+			taken = TakeObject(index);
 		}
 
-		return false;
+		structure.Add(std::move(taken));
+		return true;
 	}
 
 	void SceneStructure::Clear()
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+		Scenes::WaitFrame();
 
+		{
+			std::lock_guard<std::mutex> dirtyLock(m_dirtyMutex);
+			m_dirty.clear();
+		}
+
+		// Every used slot gets a new generation, so handles to the cleared entities stay invalid once the slots are reused.
+		for (uint32_t i = 0; i < m_slots.size(); i++)
+		{
+			if (m_slots[i].m_entity != nullptr)
+			{
+				m_slots[i].m_entity = nullptr;
+				m_slots[i].m_generation++;
+				m_slots[i].m_nextFree = m_freeSlot;
+				m_freeSlot = i;
+			}
+		}
+
+		m_registries.clear();
+		m_tree.Clear();
+		m_transforms.Clear();
+		m_archetypes.clear();
 		m_objects.clear();
 	}
 
 	void SceneStructure::Update()
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+		m_tick++;
+		m_tickTime = Engine::GetTime();
 
-		for (auto it = m_objects.begin(); it != m_objects.end();)
+		// Entities created while updating are added to the end, so they are updated this frame too.
+		for (uint32_t i = 0; i < m_objects.size();)
 		{
-			if ((*it)->IsRemoved())
+			auto object = m_objects[i].get();
+
+			if (object->IsRemoved())
 			{
-				it = m_objects.erase(it);
+				Scenes::WaitFrame();
+				Detach(object);
+				TakeObject(i);
 				continue;
 			}
 
-			(*it)->Update();
-			++it;
+			object->Update();
+			i++;
 		}
+
+		m_transforms.Update();
+		UpdateBounds();
 	}
 
 	std::vector<Entity *> SceneStructure::QueryAll()
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
 		std::vector<Entity *> result = {};
 
@@ -120,50 +206,385 @@ namespace acid
 
 	std::vector<Entity *> SceneStructure::QueryFrustum(const Frustum &range)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		std::vector<Entity *> result = {};
+
+		QueryFrustum(range, [&](Entity *object)
+		{
+			result.emplace_back(object);
+		});
+
+		return result;
+	}
 
+	std::vector<Entity *> SceneStructure::QuerySphere(const Vector3 &centre, const float &radius)
+	{
 		std::vector<Entity *> result = {};
 
+		Query([&](const Aabb &bounds)
+		{
+			return bounds.Intersects(centre, radius);
+		}, [&](Entity *object)
+		{
+			result.emplace_back(object);
+		});
+
+		return result;
+	}
+
+	std::vector<Entity *> SceneStructure::QueryCube(const Vector3 &min, const Vector3 &max)
+	{
+		std::vector<Entity *> result = {};
+		Aabb range = Aabb(min, max);
+
+		Query([&](const Aabb &bounds)
+		{
+			return bounds.Intersects(range);
+		}, [&](Entity *object)
+		{
+			result.emplace_back(object);
+		});
+
+		return result;
+	}
+
+	std::vector<Entity *> SceneStructure::QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance)
+	{
+		std::vector<std::pair<float, Entity *>> hits = {};
+		Vector3 inverseDirection = 1.0f / direction;
+
+		Query([&](const Aabb &bounds)
+		{
+			return bounds.Intersects(origin, inverseDirection, distance).has_value();
+		}, [&](Entity *object)
+		{
+			hits.emplace_back(*object->m_bounds.Intersects(origin, inverseDirection, distance), object);
+		});
+
+		std::sort(hits.begin(), hits.end(), [](const std::pair<float, Entity *> &a, const std::pair<float, Entity *> &b)
+		{
+			return a.first < b.first;
+		});
+
+		std::vector<Entity *> result = {};
+		result.reserve(hits.size());
+
+		for (auto &[hitDistance, object] : hits)
+		{
+			result.emplace_back(object);
+		}
+
+		return result;
+	}
+
+	bool SceneStructure::Contains(Entity *object)
+	{
+		return object != nullptr && object->m_structure == this;
+	}
+
+	Entity *SceneStructure::GetEntity(const EntityHandle &handle)
+	{
+		std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+		if (handle.GetIndex() >= m_slots.size())
+		{
+			return nullptr;
+		}
+
+		auto &slot = m_slots[handle.GetIndex()];
+		return slot.m_generation == handle.GetGeneration() ? slot.m_entity : nullptr;
+	}
+
+	void SceneStructure::Attach(Entity *object)
+	{
+		uint32_t slot = m_freeSlot;
+
+		if (slot != NULL_SLOT)
+		{
+			m_freeSlot = m_slots[slot].m_nextFree;
+		}
+		else
+		{
+			slot = static_cast<uint32_t>(m_slots.size());
+			m_slots.emplace_back(Slot{nullptr, 0, NULL_SLOT});
+		}
+
+		m_slots[slot].m_entity = object;
+		object->m_handle = EntityHandle(slot, m_slots[slot].m_generation);
+		object->m_objectIndex = static_cast<uint32_t>(m_objects.size());
+		object->m_structure = this;
+		m_transforms.Add(object);
+		object->m_bounds = object->GetBounds();
+		object->m_boundsDirty = false;
+		object->m_boundsNode = m_tree.Insert(object, object->m_bounds);
+		MarkDirty(object);
+	}
+
+	void SceneStructure::Detach(Entity *object)
+	{
+		auto &slot = m_slots[object->m_handle.GetIndex()];
+		slot.m_entity = nullptr;
+		slot.m_generation++;
+		slot.m_nextFree = m_freeSlot;
+		m_freeSlot = object->m_handle.GetIndex();
+		object->m_handle = EntityHandle();
+
+		RemoveRow(object);
+		m_transforms.Remove(object);
+
+		// Children of a leaving entity become roots here, they are calculated again without it.
+		for (auto &child : object->m_children)
+		{
+			child->m_localTransform.SetDirty(true);
+		}
+
+		if (object->m_boundsNode != BoundingTree::NULL_NODE)
+		{
+			m_tree.Remove(object->m_boundsNode);
+			object->m_boundsNode = BoundingTree::NULL_NODE;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_dirtyMutex);
+
+			// The last queued entity takes its place, so removing many entities does not search the queue for each.
+			if (object->m_archetypeDirty)
+			{
+				auto last = m_dirty.back();
+				m_dirty[object->m_dirtyIndex] = last;
+				last->m_dirtyIndex = object->m_dirtyIndex;
+				m_dirty.pop_back();
+				object->m_archetypeDirty = false;
+			}
+		}
+
+		object->m_structure = nullptr;
+	}
+
+	std::unique_ptr<Entity> SceneStructure::TakeObject(const uint32_t &index)
+	{
+		auto object = std::move(m_objects[index]);
+
+		if (index + 1 != m_objects.size())
+		{
+			m_objects[index] = std::move(m_objects.back());
+			m_objects[index]->m_objectIndex = index;
+		}
+
+		m_objects.pop_back();
+		return object;
+	}
+
+	void SceneStructure::UpdateBounds()
+	{
 		for (auto &object : m_objects)
 		{
-			if (object->IsRemoved())
+			// The transform hierarchy marks every entity it moved, components mark bounds they changed.
+			if (!object->m_boundsDirty)
 			{
 				continue;
 			}
 
-			auto rigidbody = object->GetComponent<Rigidbody>();
+			object->m_bounds = object->GetBounds();
+			object->m_boundsDirty = false;
+			m_tree.Update(object->m_boundsNode, object->m_bounds);
+		}
+	}
+
+	void SceneStructure::MarkDirty(Entity *object)
+	{
+		std::lock_guard<std::mutex> lock(m_dirtyMutex);
 
-			if (rigidbody == nullptr || rigidbody->InFrustum(range))
+		if (!object->m_archetypeDirty)
+		{
+			object->m_archetypeDirty = true;
+			object->m_dirtyIndex = static_cast<uint32_t>(m_dirty.size());
+			m_dirty.emplace_back(object);
+		}
+	}
+
+	void SceneStructure::UpdateArchetypes()
+	{
+		std::vector<Entity *> dirty;
+
+		{
+			std::lock_guard<std::mutex> lock(m_dirtyMutex);
+			dirty.swap(m_dirty);
+
+			for (auto &object : dirty)
 			{
-				result.emplace_back(object.get());
+				object->m_archetypeDirty = false;
 			}
 		}
 
-		return result;
+		// Every old row is removed before any new row is added, a deleted component's address may already be reused by a added one.
+		for (auto &object : dirty)
+		{
+			RemoveRow(object);
+		}
+
+		std::vector<std::pair<uint32_t, Component *>> components;
+		std::vector<uint32_t> signature;
+		std::vector<Component *> row;
+
+		for (auto &object : dirty)
+		{
+			components.clear();
+			signature.clear();
+			row.clear();
+
+			for (auto &component : object->GetComponents())
+			{
+				components.emplace_back(component->GetTypeId(), component.get());
+			}
+
+			// Components of the same type keep the order they were added in.
+			std::stable_sort(components.begin(), components.end(), [](const std::pair<uint32_t, Component *> &a, const std::pair<uint32_t, Component *> &b)
+			{
+				return a.first < b.first;
+			});
+
+			for (auto &[typeId, component] : components)
+			{
+				signature.emplace_back(typeId);
+				row.emplace_back(component);
+
+				for (auto &registry : m_registries)
+				{
+					if (registry != nullptr && registry->Matches(component))
+					{
+						registry->Add(component);
+					}
+				}
+			}
+
+			auto &archetype = m_archetypes[signature];
+
+			if (archetype == nullptr)
+			{
+				archetype = std::make_unique<Archetype>(signature);
+			}
+
+			object->m_archetype = archetype.get();
+			object->m_archetypeRow = archetype->Add(object, row);
+		}
 	}
 
-	/*std::vector<Entity *> SceneStructure::QuerySphere(const Vector3 &centre, const Vector3 &radius)
+	void SceneStructure::FillRegistry(ComponentRegistry &registry)
 	{
-		return std::vector<Entity *>();
-	}*/
+		for (auto &[signature, archetype] : m_archetypes)
+		{
+			if (archetype->GetSize() == 0)
+			{
+				continue;
+			}
 
-	/*std::vector<Entity *> SceneStructure::QueryCube(const Vector3 &min, const Vector3 &max)
-	{
-		return std::vector<Entity *>();
-	}*/
+			for (uint32_t i = 0; i < signature.size(); i++)
+			{
+				auto &column = archetype->GetColumn(i);
 
-	bool SceneStructure::Contains(Entity *object)
+				if (!registry.Matches(column[0]))
+				{
+					continue;
+				}
+
+				for (auto &component : column)
+				{
+					registry.Add(component);
+				}
+			}
+		}
+	}
+
+	void SceneStructure::RemoveRow(Entity *object)
 	{
-		std::lock_guard<std::mutex> lock(m_mutex);
+		auto archetype = object->m_archetype;
 
-		for (auto &object2 : m_objects)
+		if (archetype == nullptr)
 		{
-			if (object2.get() == object)
+			return;
+		}
+
+		auto &signature = archetype->GetSignature();
+
+		// Only the type ids are read, components removed from the entity have already been deleted.
+		for (uint32_t i = 0; i < signature.size(); i++)
+		{
+			for (auto &registry : m_registries)
 			{
-				return true;
+				if (registry != nullptr && registry->IsMatched(signature[i]))
+				{
+					registry->Remove(archetype->GetColumn(i)[object->m_archetypeRow]);
+				}
 			}
 		}
 
-		return false;
+		auto moved = archetype->Remove(object->m_archetypeRow);
+
+		if (moved != nullptr)
+		{
+			moved->m_archetypeRow = object->m_archetypeRow;
+		}
+
+		object->m_archetype = nullptr;
+	}
+
+	SceneStructure::ComponentRegistry::ComponentRegistry(bool(*cast)(Component *)) :
+		m_cast(cast),
+		m_types(std::vector<int8_t>()),
+		m_components(std::vector<Component *>()),
+		m_indices(std::unordered_map<Component *, uint32_t>()),
+		m_removed(0)
+	{
+	}
+
+	bool SceneStructure::ComponentRegistry::Matches(Component *component)
+	{
+		auto typeId = component->GetTypeId();
+
+		if (typeId >= m_types.size())
+		{
+			m_types.resize(typeId + 1, -1);
+		}
+
+		if (m_types[typeId] < 0)
+		{
+			m_types[typeId] = m_cast(component) ? 1 : 0;
+		}
+
+		return m_types[typeId] > 0;
+	}
+
+	void SceneStructure::ComponentRegistry::Add(Component *component)
+	{
+		m_indices[component] = static_cast<uint32_t>(m_components.size());
+		m_components.emplace_back(component);
+	}
+
+	void SceneStructure::ComponentRegistry::Remove(Component *component)
+	{
+		auto it = m_indices.find(component);
+
+		if (it == m_indices.end())
+		{
+			return;
+		}
+
+		m_components[it->second] = nullptr;
+		m_indices.erase(it);
+		m_removed++;
+
+		// Gaps are removed without reordering, so the first component of a type does not change when others are removed.
+		if (m_removed * 4 <= m_components.size())
+		{
+			return;
+		}
+
+		m_components.erase(std::remove(m_components.begin(), m_components.end(), nullptr), m_components.end());
+		m_removed = 0;
+
+		for (uint32_t i = 0; i < m_components.size(); i++)
+		{
+			m_indices[m_components[i]] = i;
+		}
 	}
 }
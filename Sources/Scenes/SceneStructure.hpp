@@ -1,22 +1,161 @@
 ﻿#pragma once
 
 #include <algorithm>
+#include <map>
 #include <mutex>
+#include <optional>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
+#include "Engine/Engine.hpp"
+#include "Memory/FrameArena.hpp"
 #include "Physics/Rigidbody.hpp"
+#include "Archetype.hpp"
+#include "BoundingTree.hpp"
 #include "Component.hpp"
 #include "Entity.hpp"
+#include "TransformHierarchy.hpp"
 
 namespace acid
 {
+	class EntityPrefab;
+
 	/// <summary>
 	/// A structure of spatial objects for a scene.
 	/// </summary>
 	class ACID_EXPORT SceneStructure
 	{
 	private:
-		std::mutex m_mutex;
+		friend class Entity;
+
+		/// <summary>
+		/// The data a query reads from one column of a archetype, <seealso cref="Transform"/> is read from the entities local transform.
+		/// </summary>
+		/// <param name="T"> The queried type. </param>
+		template<typename T>
+		class EachColumn
+		{
+		private:
+			Component *const *m_components = nullptr;
+		public:
+			bool Find(Archetype &archetype)
+			{
+				if constexpr (std::is_same_v<T, Transform>)
+				{
+					return true;
+				}
+				else
+				{
+					auto column = archetype.FindColumn<T>();
+
+					if (!column)
+					{
+						return false;
+					}
+
+					m_components = archetype.GetColumn(*column).data();
+					return true;
+				}
+			}
+
+			bool IsEnabled(const uint32_t &row) const
+			{
+				if constexpr (std::is_same_v<T, Transform>)
+				{
+					return true;
+				}
+				else
+				{
+					return m_components[row]->IsEnabled();
+				}
+			}
+
+			T &Get(const Archetype &archetype, const uint32_t &row) const
+			{
+				if constexpr (std::is_same_v<T, Transform>)
+				{
+					return archetype.GetEntity(row)->GetLocalTransform();
+				}
+				else
+				{
+					return *static_cast<T *>(m_components[row]);
+				}
+			}
+		};
+
+		/// <summary>
+		/// A archetype matched by a query, with the columns for each queried type and the index of its first row over every match.
+		/// </summary>
+		template<typename... Ts>
+		struct EachMatch
+		{
+			Archetype *m_archetype;
+			std::tuple<EachColumn<Ts>...> m_columns;
+			uint32_t m_offset;
+		};
+
+		/// <summary>
+		/// Every component in the structure that can be cast to a queried type, kept up to date as entities change archetypes.
+		/// Components stay in the order they were added, removed ones leave a null until a quarter of the list is removed.
+		/// </summary>
+		class ComponentRegistry
+		{
+		private:
+			bool(*m_cast)(Component *);
+			std::vector<int8_t> m_types;
+			std::vector<Component *> m_components;
+			std::unordered_map<Component *, uint32_t> m_indices;
+			uint32_t m_removed;
+		public:
+			explicit ComponentRegistry(bool(*cast)(Component *));
+
+			/// <summary>
+			/// Gets if a component belongs in this registry, the result is kept for its type.
+			/// </summary>
+			/// <param name="component"> The component to check. </param>
+			/// <returns> If the component can be cast to the registries type. </returns>
+			bool Matches(Component *component);
+
+			/// <summary>
+			/// Gets if components of a type have been matched before, the component is not read so it may already be deleted.
+			/// </summary>
+			/// <param name="typeId"> The component type id. </param>
+			/// <returns> If the type is known to be in this registry. </returns>
+			bool IsMatched(const uint32_t &typeId) const { return typeId < m_types.size() && m_types[typeId] > 0; }
+
+			void Add(Component *component);
+
+			void Remove(Component *component);
+
+			const std::vector<Component *> &GetComponents() const { return m_components; }
+		};
+
+		/// <summary>
+		/// A slot a entity handle points to, free slots are linked through their next index.
+		/// </summary>
+		struct Slot
+		{
+			Entity *m_entity;
+			uint32_t m_generation;
+			uint32_t m_nextFree;
+		};
+
+		static const uint32_t NULL_SLOT;
+
+		// Recursive so a job run by a thread waiting inside a parallel query can still read the structure.
+		std::recursive_mutex m_mutex;
 		std::vector<std::unique_ptr<Entity>> m_objects;
+		std::vector<Slot> m_slots;
+		uint32_t m_freeSlot;
+		std::map<std::vector<uint32_t>, std::unique_ptr<Archetype>> m_archetypes;
+		std::mutex m_dirtyMutex;
+		std::vector<Entity *> m_dirty;
+		std::vector<std::unique_ptr<ComponentRegistry>> m_registries;
+		BoundingTree m_tree;
+		TransformHierarchy m_transforms;
+		uint32_t m_tick;
+		Time m_tickTime;
+		std::optional<Vector3> m_viewPosition;
 	public:
 		/// <summary>
 		/// Creates a new scene structure.
@@ -42,6 +181,23 @@ namespace acid
 		/// <returns> The newly created entity. </returns>
 		Entity *CreateEntity(const std::string &filename, const Transform &transform);
 
+		/// <summary>
+		/// Creates a new entity with the components of a prefab that starts in this structure.
+		/// </summary>
+		/// <param name="prefab"> The prefab to copy the components of. </param>
+		/// <param name="transform"> The objects initial world position, rotation, and scale. </param>
+		/// <returns> The newly created entity. </returns>
+		Entity *Instantiate(const EntityPrefab &prefab, const Transform &transform);
+
+		/// <summary>
+		/// Creates a entity with the components of a prefab for every transform, the structure is only locked once.
+		/// Components are added before the entities join the structure, so each entity is sorted into its archetype once.
+		/// </summary>
+		/// <param name="prefab"> The prefab to copy the components of. </param>
+		/// <param name="transforms"> The initial transform of each entity. </param>
+		/// <returns> The newly created entities, in the order of the transforms. </returns>
+		std::vector<Entity *> Instantiate(const EntityPrefab &prefab, const std::vector<Transform> &transforms);
+
 		/// <summary>
 		/// Adds a new object to the spatial structure.
 		/// </summary>
@@ -61,6 +217,13 @@ namespace acid
 		/// <returns> If the object was removed. </returns>
 		bool Remove(Entity *object);
 
+		/// <summary>
+		/// Removes an object from the spatial structure.
+		/// </summary>
+		/// <param name="handle"> The handle of the object to remove. </param>
+		/// <returns> If the object was removed, false if the handle no longer points to a object. </returns>
+		bool Remove(const EntityHandle &handle);
+
 		/// <summary>
 		/// Moves an object to another spatial structure.
 		/// </summary>
@@ -75,10 +238,23 @@ namespace acid
 		void Clear();
 
 		/// <summary>
-		/// Updates all of the entity.
+		/// Updates all of the entity, then calculates the world transforms of moved entities and moves them in the bounding tree.
 		/// </summary>
 		void Update();
 
+		/// <summary>
+		/// Gets the amount of times this structure has been updated, components not updated every tick are scheduled by it.
+		/// </summary>
+		/// <returns> The tick count. </returns>
+		uint32_t GetTick() const { return m_tick; }
+
+		/// <summary>
+		/// Sets the position components with a distance update rate are measured from, usually the camera.
+		/// Without a position those components are updated every tick.
+		/// </summary>
+		/// <param name="viewPosition"> The view position. </param>
+		void SetViewPosition(const std::optional<Vector3> &viewPosition) { m_viewPosition = viewPosition; }
+
 		/// <summary>
 		/// Gets the size of this structure.
 		/// </summary>
@@ -100,32 +276,77 @@ namespace acid
 		/// <returns> The list of all object in range. </returns>
 		std::vector<Entity *> QueryFrustum(const Frustum &range);
 
-	//	std::vector<Entity *> QuerySphere(const Vector3 &centre, const Vector3 &radius);
+		/// <summary>
+		/// Calls a function with every object with bounds partially in a frustum, found through the bounding tree.
+		/// Bounds are updated with the structure, so objects moved since then are found where they were.
+		/// </summary>
+		/// <param name="range"> The frustum range of space being queried. </param>
+		/// <param name="function"> The function, given each object found. </param>
+		template<typename F>
+		void QueryFrustum(const Frustum &range, F &&function)
+		{
+			Query([&](const Aabb &bounds)
+			{
+				return range.CubeInFrustum(bounds.m_min, bounds.m_max);
+			}, function);
+		}
+
+		/// <summary>
+		/// Returns a set of all objects with bounds overlapping a sphere.
+		/// </summary>
+		/// <param name="centre"> The spheres centre. </param>
+		/// <param name="radius"> The spheres radius. </param>
+		/// <returns> The list of all object in range. </returns>
+		std::vector<Entity *> QuerySphere(const Vector3 &centre, const float &radius);
+
+		/// <summary>
+		/// Returns a set of all objects with bounds overlapping a axis aligned cube.
+		/// </summary>
+		/// <param name="min"> The cubes minimum corner. </param>
+		/// <param name="max"> The cubes maximum corner. </param>
+		/// <returns> The list of all object in range. </returns>
+		std::vector<Entity *> QueryCube(const Vector3 &min, const Vector3 &max);
+
+		/// <summary>
+		/// Returns a set of all objects with bounds hit by a ray.
+		/// </summary>
+		/// <param name="origin"> The rays origin. </param>
+		/// <param name="direction"> The rays direction. </param>
+		/// <param name="distance"> The length of the ray. </param>
+		/// <returns> The list of all objects hit, sorted from the closest. </returns>
+		std::vector<Entity *> QueryRay(const Vector3 &origin, const Vector3 &direction, const float &distance);
+
+		/// <summary>
+		/// Gets the bounding tree the spatial queries are answered from.
+		/// </summary>
+		/// <returns> The bounding tree. </returns>
+		const BoundingTree &GetBoundingTree() const { return m_tree; }
 
-	//	std::vector<Entity *> QueryCube(const Vector3 &min, const Vector3 &max);
+		/// <summary>
+		/// Gets the transform hierarchy the world matrices of entities are kept in.
+		/// </summary>
+		/// <returns> The transform hierarchy. </returns>
+		TransformHierarchy &GetTransformHierarchy() { return m_transforms; }
 
 		/// <summary>
-		/// Returns a set of all components of a type in the spatial structure.
+		/// Returns a set of all components of a type in the spatial structure, read from a registry kept for the type so only matches are visited.
 		/// </summary>
 		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
-		/// <returns> The list specified by of all components that match the type. </returns>
+		/// <returns> The list specified by of all components that match the type, in the order they were added. </returns>
 		template<typename T>
 		std::vector<T *> QueryComponents(const bool &allowDisabled = false)
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+			auto &components = GetRegistry<T>().GetComponents();
 
 			std::vector<T *> result = {};
+			result.reserve(components.size());
 
-			for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+			for (auto &component : components)
 			{
-				auto components = (*it)->GetComponents<T>();
-
-				for (auto &component : components)
+				if (component != nullptr && (component->IsEnabled() || allowDisabled))
 				{
-					if (component != nullptr && (component->IsEnabled() || allowDisabled))
-					{
-						result.emplace_back(component);
-					}
+					result.emplace_back(static_cast<T *>(component));
 				}
 			}
 
@@ -136,25 +357,85 @@ namespace acid
 		/// Returns the first component of a type found in the spatial structure.
 		/// </summary>
 		/// <param name="allowDisabled"> If disabled components will be included in this query. </param>
-		/// <returns> The first component of the type found. </returns>
+		/// <returns> The first component of the type found, the earliest added. </returns>
 		template<typename T>
 		T *GetComponent(const bool &allowDisabled = false)
 		{
-			std::lock_guard<std::mutex> lock(m_mutex);
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
 
-			for (auto it = m_objects.begin(); it != m_objects.end(); ++it)
+			for (auto &component : GetRegistry<T>().GetComponents())
 			{
-				auto component = (*it)->GetComponent<T>();
-
 				if (component != nullptr && (component->IsEnabled() || allowDisabled))
 				{
-					return component;
+					return static_cast<T *>(component);
 				}
 			}
 
 			return nullptr;
 		}
 
+		/// <summary>
+		/// Calls a function with the components of every entity that has all of the queried types, entities are read from packed archetype columns.
+		/// Entities with a disabled queried component are skipped. The function must not add or remove entities,
+		/// added or removed components are seen by the next query.
+		/// </summary>
+		/// <param name="function"> The function, given a reference to each queried type. </param>
+		/// <param name="Ts"> The queried component types, <seealso cref="Transform"/> gives the entities local transform. </param>
+		template<typename... Ts, typename F>
+		void Each(F &&function)
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+			auto matches = FindMatches<Ts...>();
+
+			for (auto &match : matches)
+			{
+				EachRows(match, 0, match.m_archetype->GetSize(), function);
+			}
+		}
+
+		/// <summary>
+		/// Calls a function like <seealso cref="#Each()"/>, with the rows split into ranges run on the job system.
+		/// The function is called from several threads at once, so it may only write to the components it is given.
+		/// </summary>
+		/// <param name="function"> The function, given a reference to each queried type. </param>
+		/// <param name="grainSize"> The smallest amount of entities given to a job, 0 will split them evenly over the workers. </param>
+		/// <param name="Ts"> The queried component types, <seealso cref="Transform"/> gives the entities local transform. </param>
+		template<typename... Ts, typename F>
+		void EachParallel(F &&function, const uint32_t &grainSize = 0)
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+			auto matches = FindMatches<Ts...>();
+
+			if (matches.empty())
+			{
+				return;
+			}
+
+			uint32_t count = matches.back().m_offset + matches.back().m_archetype->GetSize();
+
+			// A range can span several archetypes, the first is found from the row offsets.
+			Engine::Get()->GetJobSystem().ParallelFor(0, count, [&](uint32_t begin, uint32_t end)
+			{
+				auto it = std::upper_bound(matches.begin(), matches.end(), begin, [](const uint32_t &index, const EachMatch<Ts...> &match)
+				{
+					return index < match.m_offset;
+				}) - 1;
+
+				for (; it != matches.end() && it->m_offset < end; ++it)
+				{
+					uint32_t first = std::max(begin, it->m_offset) - it->m_offset;
+					uint32_t last = std::min(end - it->m_offset, it->m_archetype->GetSize());
+					EachRows(*it, first, last, function);
+				}
+			}, grainSize);
+		}
+
+		/// <summary>
+		/// Gets the amount of archetypes, including ones that currently have no entities.
+		/// </summary>
+		/// <returns> The archetype count. </returns>
+		uint32_t GetArchetypeCount() const { return static_cast<uint32_t>(m_archetypes.size()); }
+
 		/// <summary>
 		/// If the structure contains the object.
 		/// </summary>
@@ -162,5 +443,152 @@ namespace acid
 		/// </param>
 		/// <returns> If the structure contains the object. </returns>
 		bool Contains(Entity *object);
+
+		/// <summary>
+		/// Gets the object a handle points to.
+		/// </summary>
+		/// <param name="handle"> The handle. </param>
+		/// <returns> The object, or null if it has been removed from this structure. </returns>
+		Entity *GetEntity(const EntityHandle &handle);
+	private:
+		/// <summary>
+		/// Calls a function with every object whose bounds pass a test, the test is first used to skip whole branches of the bounding tree.
+		/// </summary>
+		/// <param name="test"> The test, given a node or object bounds. </param>
+		/// <param name="function"> The function, given each object found. </param>
+		template<typename T, typename F>
+		void Query(T &&test, F &&function)
+		{
+			std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+			m_tree.Query(test, [&](Entity *object)
+			{
+				if (!object->IsRemoved() && test(object->m_bounds))
+				{
+					function(object);
+				}
+			});
+		}
+
+		template<typename T>
+		ComponentRegistry &GetRegistry()
+		{
+			UpdateArchetypes();
+
+			auto typeId = Entity::GetTypeId<T>();
+
+			if (typeId >= m_registries.size())
+			{
+				m_registries.resize(typeId + 1);
+			}
+
+			auto &registry = m_registries[typeId];
+
+			if (registry == nullptr)
+			{
+				registry = std::make_unique<ComponentRegistry>([](Component *component)
+				{
+					return dynamic_cast<T *>(component) != nullptr;
+				});
+				FillRegistry(*registry);
+			}
+
+			return *registry;
+		}
+
+		template<typename... Ts>
+		FrameVector<EachMatch<Ts...>> FindMatches()
+		{
+			UpdateArchetypes();
+
+			FrameVector<EachMatch<Ts...>> matches = {};
+			uint32_t offset = 0;
+
+			for (auto &[signature, archetype] : m_archetypes)
+			{
+				if (archetype->GetSize() == 0)
+				{
+					continue;
+				}
+
+				EachMatch<Ts...> match = {archetype.get(), {}, offset};
+				bool found = std::apply([&](auto &... column)
+				{
+					return (column.Find(*archetype) && ...);
+				}, match.m_columns);
+
+				if (found)
+				{
+					matches.emplace_back(match);
+					offset += archetype->GetSize();
+				}
+			}
+
+			return matches;
+		}
+
+		template<typename... Ts, typename F>
+		static void EachRows(const EachMatch<Ts...> &match, const uint32_t &begin, const uint32_t &end, F &function)
+		{
+			auto &archetype = *match.m_archetype;
+
+			for (uint32_t row = begin; row < end; row++)
+			{
+				std::apply([&](auto &... column)
+				{
+					if ((column.IsEnabled(row) && ...))
+					{
+						function(column.Get(archetype, row)...);
+					}
+				}, match.m_columns);
+			}
+		}
+
+		/// <summary>
+		/// Gives a entity added to this structure a handle and starts tracking its archetype, transform and bounds.
+		/// </summary>
+		/// <param name="object"> The added entity. </param>
+		void Attach(Entity *object);
+
+		/// <summary>
+		/// Frees the handle of a entity and removes it from its archetype, called before it leaves this structure.
+		/// </summary>
+		/// <param name="object"> The leaving entity. </param>
+		void Detach(Entity *object);
+
+		/// <summary>
+		/// Takes a entity out of the objects list by moving the last entity into its place.
+		/// </summary>
+		/// <param name="index"> The index of the entity in the objects list. </param>
+		/// <returns> The entity. </returns>
+		std::unique_ptr<Entity> TakeObject(const uint32_t &index);
+
+		/// <summary>
+		/// Adds the components already in archetypes to a new registry.
+		/// </summary>
+		/// <param name="registry"> The registry to fill. </param>
+		void FillRegistry(ComponentRegistry &registry);
+
+		/// <summary>
+		/// Removes a entity from its archetype and its components from the registries.
+		/// </summary>
+		/// <param name="object"> The entity, its components may have already been deleted. </param>
+		void RemoveRow(Entity *object);
+
+		/// <summary>
+		/// Moves every entity with changed bounds in the bounding tree.
+		/// </summary>
+		void UpdateBounds();
+
+		/// <summary>
+		/// Queues a entity to be moved to a new archetype, its components have changed.
+		/// </summary>
+		/// <param name="object"> The changed entity. </param>
+		void MarkDirty(Entity *object);
+
+		/// <summary>
+		/// Moves every queued entity into the archetype matching its components.
+		/// </summary>
+		void UpdateArchetypes();
 	};
 }
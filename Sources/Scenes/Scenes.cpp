@@ -1,10 +1,18 @@
 #include "Scenes.hpp"
 
+#include <atomic>
+#include "Renderer/Renderer.hpp"
+
 namespace acid
 {
+	static std::atomic<uint64_t> INSTANCES = 0;
+
 	Scenes::Scenes() :
 		m_scene(nullptr),
-		m_componentRegister(ComponentRegister())
+		m_componentRegister(ComponentRegister()),
+		m_instance(++INSTANCES),
+		m_commandMutex(std::mutex()),
+		m_commandBuffers(std::vector<std::unique_ptr<EntityCommandBuffer>>())
 	{
 	}
 
@@ -26,6 +34,14 @@ namespace acid
 
 		if (m_scene->GetStructure() != nullptr)
 		{
+			PlaybackCommands();
+
+			// The camera is updated after the structure, so components are scheduled from where it was last frame.
+			if (m_scene->GetCamera() != nullptr)
+			{
+				m_scene->GetStructure()->SetViewPosition(m_scene->GetCamera()->GetPosition());
+			}
+
 			m_scene->GetStructure()->Update();
 		}
 
@@ -34,4 +50,69 @@ namespace acid
 			m_scene->GetCamera()->Update();
 		}
 	}
+
+	void Scenes::SetScene(Scene *scene)
+	{
+		WaitFrame();
+		m_scene.reset(scene);
+
+		// Handles recorded for the old structure could point to entities in the new one.
+		// The list is not locked while clearing, a deleted component may ask for the command buffer of a thread that has none yet.
+		for (auto &buffer : GetCommandBuffers())
+		{
+			buffer->Clear();
+		}
+	}
+
+	void Scenes::WaitFrame()
+	{
+		auto renderer = Renderer::Get();
+
+		if (renderer != nullptr)
+		{
+			renderer->WaitFrame();
+		}
+	}
+
+	EntityCommandBuffer &Scenes::GetCommandBuffer()
+	{
+		// The instance is kept with the buffer, so a thread never uses a buffer of a destroyed module.
+		static thread_local std::pair<uint64_t, EntityCommandBuffer *> cached = {0, nullptr};
+
+		if (cached.first != m_instance)
+		{
+			std::lock_guard<std::mutex> lock(m_commandMutex);
+			m_commandBuffers.emplace_back(std::make_unique<EntityCommandBuffer>());
+			cached = {m_instance, m_commandBuffers.back().get()};
+		}
+
+		return *cached.second;
+	}
+
+	void Scenes::PlaybackCommands()
+	{
+		// The list is not locked while playing back, a destroyed component may ask for the command buffer of a thread that has none yet.
+		// Each buffer locks itself, so threads still recording into it only add to the next playback.
+		for (auto &buffer : GetCommandBuffers())
+		{
+			if (!buffer->IsEmpty())
+			{
+				buffer->Playback(*m_scene->GetStructure());
+			}
+		}
+	}
+
+	std::vector<EntityCommandBuffer *> Scenes::GetCommandBuffers()
+	{
+		std::lock_guard<std::mutex> lock(m_commandMutex);
+		std::vector<EntityCommandBuffer *> buffers;
+		buffers.reserve(m_commandBuffers.size());
+
+		for (auto &buffer : m_commandBuffers)
+		{
+			buffers.emplace_back(buffer.get());
+		}
+
+		return buffers;
+	}
 }
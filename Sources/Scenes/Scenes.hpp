@@ -1,9 +1,11 @@
 #pragma once
 
+#include <mutex>
 #include "Engine/Engine.hpp"
 #include "Models/ModelRegister.hpp"
 #include "Scene.hpp"
 #include "ComponentRegister.hpp"
+#include "EntityCommandBuffer.hpp"
 #include "SceneStructure.hpp"
 
 namespace acid
@@ -19,6 +21,10 @@ namespace acid
 
 		ComponentRegister m_componentRegister;
 		ModelRegister m_modelRegister;
+
+		uint64_t m_instance;
+		std::mutex m_commandMutex;
+		std::vector<std::unique_ptr<EntityCommandBuffer>> m_commandBuffers;
 	public:
 		/// <summary>
 		/// Gets this engine instance.
@@ -35,6 +41,20 @@ namespace acid
 
 		void Update() override;
 
+		/// <summary>
+		/// Waits for the frame being recorded by a pipelined renderer, must be called before entities or components are destroyed.
+		/// </summary>
+		static void WaitFrame();
+
+		/// <summary>
+		/// Gets the command buffer of the calling thread, it is played back into the scene structure once a frame,
+		/// after the scene and physics update and before entities are updated. Commands recorded by entities updating are played back the next frame.
+		/// Buffers lock while recording, commands recorded during a playback are played back the next frame.
+		/// A created entity joins the structure on playback, so it is only changed directly until then.
+		/// </summary>
+		/// <returns> The calling threads command buffer. </returns>
+		EntityCommandBuffer &GetCommandBuffer();
+
 		/// <summary>
 		/// Gets the current scene.
 		/// </summary>
@@ -45,7 +65,7 @@ namespace acid
 		/// Sets the current scene to a new scene.
 		/// </summary>
 		/// <param name="scene"> The new scene. </param>
-		void SetScene(Scene *scene) { m_scene.reset(scene); }
+		void SetScene(Scene *scene);
 
 		/// <summary>
 		/// Gets the component register used by the engine. The register can be used to register/deregister component types.
@@ -88,5 +108,16 @@ namespace acid
 		/// </summary>
 		/// <returns> If the scene is paused. </returns>
 		bool IsPaused() const { return m_scene != nullptr ? m_scene->IsPaused() : false; }
+	private:
+		/// <summary>
+		/// Plays back the command buffer of every thread, in the order the threads first recorded.
+		/// </summary>
+		void PlaybackCommands();
+
+		/// <summary>
+		/// Gets the command buffer of every thread, the list is copied under the lock so the buffers can be used without it.
+		/// </summary>
+		/// <returns> The command buffers. </returns>
+		std::vector<EntityCommandBuffer *> GetCommandBuffers();
 	};
 }
@@ -0,0 +1,19 @@
+#include "TransformComponent.hpp"
+
+namespace acid
+{
+	TransformComponent::TransformComponent(const Transform &transform) :
+		m_transform(transform)
+	{
+	}
+
+	void TransformComponent::Decode(const Metadata &metadata)
+	{
+		m_transform.Decode(metadata);
+	}
+
+	void TransformComponent::Encode(Metadata &metadata) const
+	{
+		m_transform.Encode(metadata);
+	}
+}
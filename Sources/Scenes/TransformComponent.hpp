@@ -0,0 +1,33 @@
+#pragma once
+
+#include "Maths/Transform.hpp"
+#include "Component.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A component that holds a transform, so a transform can be loaded and saved with the rest of a entities components.
+	/// </summary>
+	class ACID_EXPORT TransformComponent :
+		public Component
+	{
+	private:
+		Transform m_transform;
+	public:
+		/// <summary>
+		/// Creates a new transform component.
+		/// </summary>
+		/// <param name="transform"> The transform. </param>
+		explicit TransformComponent(const Transform &transform = Transform::IDENTITY);
+
+		void Decode(const Metadata &metadata) override;
+
+		void Encode(Metadata &metadata) const override;
+
+		const Transform &GetTransform() const { return m_transform; }
+
+		Transform &GetTransform() { return m_transform; }
+
+		void SetTransform(const Transform &transform) { m_transform = transform; }
+	};
+}
@@ -0,0 +1,234 @@
+#include "TransformHierarchy.hpp"
+
+#include <algorithm>
+#include <limits>
+#include "Engine/Engine.hpp"
+#include "Entity.hpp"
+
+namespace acid
+{
+	const uint32_t TransformHierarchy::NULL_INDEX = std::numeric_limits<uint32_t>::max();
+	const uint32_t TransformHierarchy::PARALLEL_SIZE = 4096;
+
+	TransformHierarchy::TransformHierarchy() :
+		m_entities(std::vector<Entity *>()),
+		m_parents(std::vector<uint32_t>()),
+		m_localMatrices(std::vector<Matrix4>()),
+		m_worldMatrices(std::vector<Matrix4>()),
+		m_moved(std::vector<uint8_t>()),
+		m_levels(std::vector<uint32_t>()),
+		m_removed(0),
+		m_sorted(true)
+	{
+	}
+
+	void TransformHierarchy::Add(Entity *entity)
+	{
+		// Every entity is appended with a index, so it can be removed without a search before the next sort.
+		entity->m_transformIndex = static_cast<uint32_t>(m_entities.size());
+		entity->m_localTransform.SetDirty(true);
+		m_entities.emplace_back(entity);
+		m_parents.emplace_back(NULL_INDEX);
+		m_localMatrices.emplace_back();
+		m_worldMatrices.emplace_back();
+		m_moved.emplace_back(0);
+
+		// A root without children can stay appended, nothing depends on it being sorted.
+		if (HasParent(entity) || !entity->m_children.empty())
+		{
+			m_sorted = false;
+		}
+	}
+
+	void TransformHierarchy::Remove(Entity *entity)
+	{
+		if (entity->m_transformIndex == NULL_INDEX)
+		{
+			return;
+		}
+
+		m_entities[entity->m_transformIndex] = nullptr;
+		entity->m_transformIndex = NULL_INDEX;
+		m_removed++;
+
+		// Children have to become roots, and gaps are removed once they are a quarter of the arrays.
+		if (!entity->m_children.empty() || m_removed * 4 > m_entities.size())
+		{
+			m_sorted = false;
+		}
+	}
+
+	void TransformHierarchy::Clear()
+	{
+		m_entities.clear();
+		m_parents.clear();
+		m_localMatrices.clear();
+		m_worldMatrices.clear();
+		m_moved.clear();
+		m_levels.clear();
+		m_removed = 0;
+		m_sorted = true;
+	}
+
+	void TransformHierarchy::Update()
+	{
+		if (!m_sorted)
+		{
+			Sort();
+		}
+
+		// Roots appended since the last sort have no children yet, so they can be updated first.
+		UpdateLevel(m_levels.empty() ? 0 : m_levels.back(), static_cast<uint32_t>(m_entities.size()));
+
+		// Every depth waits for the one before it, so parents are always done before their children are read.
+		for (uint32_t depth = 0; depth + 1 < m_levels.size(); depth++)
+		{
+			UpdateLevel(m_levels[depth], m_levels[depth + 1]);
+		}
+	}
+
+	void TransformHierarchy::Sort()
+	{
+		std::vector<uint32_t> previous = {};
+		std::vector<uint32_t> depths = {};
+		uint32_t maxDepth = 0;
+
+		for (uint32_t i = 0; i < m_entities.size(); i++)
+		{
+			if (m_entities[i] == nullptr)
+			{
+				continue;
+			}
+
+			uint32_t depth = 0;
+
+			for (auto entity = m_entities[i]; HasParent(entity); entity = entity->m_parent)
+			{
+				depth++;
+			}
+
+			previous.emplace_back(i);
+			depths.emplace_back(depth);
+			maxDepth = std::max(maxDepth, depth);
+		}
+
+		auto count = static_cast<uint32_t>(previous.size());
+
+		// A counting sort keeps entities at the same depth in the order they were added.
+		m_levels.assign(count == 0 ? 0 : maxDepth + 2, 0);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			m_levels[depths[i] + 1]++;
+		}
+
+		for (uint32_t depth = 1; depth < m_levels.size(); depth++)
+		{
+			m_levels[depth] += m_levels[depth - 1];
+		}
+
+		std::vector<uint32_t> offsets = m_levels;
+		std::vector<uint32_t> order(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			order[offsets[depths[i]]++] = previous[i];
+		}
+
+		// Matrices move with their entities, so only entities that changed parents are calculated again, their children follow them.
+		std::vector<Entity *> entities(count);
+		std::vector<uint32_t> parents(count);
+		std::vector<Matrix4> localMatrices(count);
+		std::vector<Matrix4> worldMatrices(count);
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			entities[i] = m_entities[order[i]];
+			localMatrices[i] = m_localMatrices[order[i]];
+			worldMatrices[i] = m_worldMatrices[order[i]];
+			entities[i]->m_transformIndex = i;
+		}
+
+		for (uint32_t i = 0; i < count; i++)
+		{
+			auto entity = entities[i];
+			auto previousParent = m_parents[order[i]] == NULL_INDEX ? nullptr : m_entities[m_parents[order[i]]];
+			parents[i] = HasParent(entity) ? entity->m_parent->m_transformIndex : NULL_INDEX;
+
+			if ((parents[i] == NULL_INDEX ? nullptr : entity->m_parent) != previousParent)
+			{
+				entity->m_localTransform.SetDirty(true);
+			}
+		}
+
+		m_entities.swap(entities);
+		m_parents.swap(parents);
+		m_localMatrices.swap(localMatrices);
+		m_worldMatrices.swap(worldMatrices);
+		m_moved.assign(count, 0);
+		m_removed = 0;
+		m_sorted = true;
+	}
+
+	bool TransformHierarchy::HasParent(const Entity *entity)
+	{
+		return entity->m_parent != nullptr && entity->m_parent->m_structure == entity->m_structure;
+	}
+
+	void TransformHierarchy::UpdateLevel(const uint32_t &begin, const uint32_t &end)
+	{
+		if (end - begin < PARALLEL_SIZE)
+		{
+			UpdateRange(begin, end);
+			return;
+		}
+
+		Engine::Get()->GetJobSystem().ParallelFor(begin, end, [this](uint32_t rangeBegin, uint32_t rangeEnd)
+		{
+			UpdateRange(rangeBegin, rangeEnd);
+		});
+	}
+
+	void TransformHierarchy::UpdateRange(const uint32_t &begin, const uint32_t &end)
+	{
+		for (uint32_t i = begin; i < end; i++)
+		{
+			auto entity = m_entities[i];
+
+			if (entity == nullptr)
+			{
+				continue;
+			}
+
+			auto parent = m_parents[i];
+			bool moved = parent != NULL_INDEX && m_moved[parent];
+
+			if (entity->m_localTransform.IsDirty())
+			{
+				m_localMatrices[i] = entity->m_localTransform.GetWorldMatrix();
+				entity->m_localTransform.SetDirty(false);
+				moved = true;
+			}
+
+			m_moved[i] = moved;
+
+			if (!moved)
+			{
+				continue;
+			}
+
+			if (parent == NULL_INDEX)
+			{
+				m_worldMatrices[i] = m_localMatrices[i];
+				entity->m_worldTransform = entity->m_localTransform;
+			}
+			else
+			{
+				m_worldMatrices[i] = m_worldMatrices[parent] * m_localMatrices[i];
+				entity->m_worldTransform = m_entities[parent]->m_worldTransform * entity->m_localTransform;
+			}
+
+			entity->m_boundsDirty = true;
+		}
+	}
+}
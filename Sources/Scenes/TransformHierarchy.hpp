@@ -0,0 +1,121 @@
+#pragma once
+
+#include <vector>
+#include "Maths/Matrix4.hpp"
+
+namespace acid
+{
+	class Entity;
+
+	/// <summary>
+	/// Keeps the local and world matrices of a structures entities in flat arrays, sorted by their depth in the entity hierarchy.
+	/// World matrices are updated once a frame, a depth at a time so every parent is done before its children,
+	/// only entities that moved or have a moved parent are calculated again and each depth is split over the job system.
+	/// Added roots are appended and removed entities leave a gap, the arrays are only sorted again when parents change or gaps build up.
+	/// </summary>
+	class ACID_EXPORT TransformHierarchy
+	{
+	private:
+		std::vector<Entity *> m_entities;
+		std::vector<uint32_t> m_parents;
+		std::vector<Matrix4> m_localMatrices;
+		std::vector<Matrix4> m_worldMatrices;
+		std::vector<uint8_t> m_moved;
+		std::vector<uint32_t> m_levels;
+		uint32_t m_removed;
+		bool m_sorted;
+	public:
+		/// <summary>
+		/// The index used for a entity not yet sorted into the hierarchy.
+		/// </summary>
+		static const uint32_t NULL_INDEX;
+
+		/// <summary>
+		/// The least amount of entities at a depth before the depth is split into jobs.
+		/// </summary>
+		static const uint32_t PARALLEL_SIZE;
+
+		/// <summary>
+		/// Creates a new empty transform hierarchy.
+		/// </summary>
+		TransformHierarchy();
+
+		/// <summary>
+		/// Adds a entity, a entity with a parent or children is sorted into the arrays on the next update.
+		/// </summary>
+		/// <param name="entity"> The entity. </param>
+		void Add(Entity *entity);
+
+		/// <summary>
+		/// Removes a entity.
+		/// </summary>
+		/// <param name="entity"> The entity. </param>
+		void Remove(Entity *entity);
+
+		/// <summary>
+		/// Sorts the entities again on the next update, called when a entity changes parents.
+		/// </summary>
+		void Invalidate() { m_sorted = false; }
+
+		/// <summary>
+		/// Removes every entity.
+		/// </summary>
+		void Clear();
+
+		/// <summary>
+		/// Calculates the world matrices and transforms of every moved entity and their children.
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Gets the world matrix of a entity, as of the last update.
+		/// </summary>
+		/// <param name="index"> The entities index. </param>
+		/// <returns> The world matrix. </returns>
+		const Matrix4 &GetWorldMatrix(const uint32_t &index) const { return m_worldMatrices[index]; }
+
+		/// <summary>
+		/// Gets the world matrices of every entity, in the order of their indices.
+		/// </summary>
+		/// <returns> The world matrices. </returns>
+		const std::vector<Matrix4> &GetWorldMatrices() const { return m_worldMatrices; }
+
+		/// <summary>
+		/// Gets the amount of entities.
+		/// </summary>
+		/// <returns> The entity count. </returns>
+		uint32_t GetSize() const { return static_cast<uint32_t>(m_entities.size()) - m_removed; }
+
+		/// <summary>
+		/// Gets the amount of levels in the hierarchy, a structure without children has a depth of 1.
+		/// </summary>
+		/// <returns> The depth. </returns>
+		uint32_t GetDepth() const { return m_levels.empty() ? 0 : static_cast<uint32_t>(m_levels.size() - 1); }
+	private:
+		/// <summary>
+		/// Sorts the entities by depth, parents are always placed before their children.
+		/// </summary>
+		void Sort();
+
+		/// <summary>
+		/// Gets if a entity has a parent in the same structure, entities with a parent elsewhere are roots here.
+		/// </summary>
+		/// <param name="entity"> The entity. </param>
+		/// <returns> If the entity has a parent. </returns>
+		static bool HasParent(const Entity *entity);
+
+		/// <summary>
+		/// Updates a range of entities that are all at the same depth, large ranges are split into jobs.
+		/// </summary>
+		/// <param name="begin"> The first index. </param>
+		/// <param name="end"> The index after the last index. </param>
+		void UpdateLevel(const uint32_t &begin, const uint32_t &end);
+
+		/// <summary>
+		/// Updates a range of entities that are all at the same depth.
+		/// </summary>
+		/// <param name="begin"> The first index. </param>
+		/// <param name="end"> The index after the last index. </param>
+		void UpdateRange(const uint32_t &begin, const uint32_t &end);
+	};
+}
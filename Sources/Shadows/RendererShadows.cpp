@@ -1,7 +1,7 @@
 #include "RendererShadows.hpp"
 
 #include "Models/VertexModel.hpp"
-#include "Scenes/Scenes.hpp"
+#include "Renderer/Renderer.hpp"
 #include "ShadowRender.hpp"
 
 namespace acid
@@ -28,9 +28,7 @@ namespace acid
 
 		m_pipeline.BindPipeline(commandBuffer);
 
-		auto sceneShadowRenders = Scenes::Get()->GetStructure()->QueryComponents<ShadowRender>();
-
-		for (auto &shadowRender : sceneShadowRenders)
+		for (auto &shadowRender : Renderer::Get()->GetSnapshot().GetShadowRenders())
 		{
 			shadowRender->CmdRender(commandBuffer, m_pipeline, m_uniformScene);
 		}
@@ -2,7 +2,9 @@
 
 #include <array>
 #include "Display/Display.hpp"
+#include "Maths/Batch.hpp"
 #include "Maths/Maths.hpp"
+#include "Physics/Aabb.hpp"
 
 namespace acid
 {
@@ -63,51 +65,9 @@ namespace acid
 		Vector3 centreFar = toFar + camera.GetPosition();
 
 		auto points = CalculateFrustumVertices(rotation, forwardVector, centreNear, centreFar);
-
-		for (uint32_t i = 0; i < 8; i++)
-		{
-			Vector4 point = points[i];
-
-			if (i == 0)
-			{
-				m_minExtents.m_x = point.m_x;
-				m_maxExtents.m_x = point.m_x;
-				m_minExtents.m_y = point.m_y;
-				m_maxExtents.m_y = point.m_y;
-				m_minExtents.m_z = point.m_z;
-				m_maxExtents.m_z = point.m_z;
-			}
-			else
-			{
-				if (point.m_x > m_maxExtents.m_x)
-				{
-					m_maxExtents.m_x = point.m_x;
-				}
-				else if (point.m_x < m_minExtents.m_x)
-				{
-					m_minExtents.m_x = point.m_x;
-				}
-
-				if (point.m_y > m_maxExtents.m_y)
-				{
-					m_maxExtents.m_y = point.m_y;
-				}
-				else if (point.m_y < m_minExtents.m_y)
-				{
-					m_minExtents.m_y = point.m_y;
-				}
-
-				if (point.m_z > m_maxExtents.m_z)
-				{
-					m_maxExtents.m_z = point.m_z;
-				}
-				else if (point.m_z < m_minExtents.m_z)
-				{
-					m_minExtents.m_z = point.m_z;
-				}
-			}
-		}
-
+		auto bounds = Batch::TransformedBounds(m_lightViewMatrix, points.data(), points.size());
+		m_minExtents = bounds.m_min;
+		m_maxExtents = bounds.m_max;
 		m_maxExtents.m_z += m_shadowOffset;
 	}
 
@@ -119,7 +79,7 @@ namespace acid
 		m_nearHeight = m_nearWidth / Display::Get()->GetAspectRatio();
 	}
 
-	std::array<Vector4, 8> ShadowBox::CalculateFrustumVertices(const Matrix4 &rotation, const Vector3 &forwardVector, const Vector3 &centreNear, const Vector3 &centreFar)
+	std::array<Vector3, 8> ShadowBox::CalculateFrustumVertices(const Matrix4 &rotation, const Vector3 &forwardVector, const Vector3 &centreNear, const Vector3 &centreFar)
 	{
 		Vector4 upVector4 = rotation.Transform(Vector4(0.0f, 1.0f, 0.0f, 0.0f));
 		Vector3 upVector = Vector3(upVector4);
@@ -137,26 +97,18 @@ namespace acid
 		Vector3 nearTop = centreNear + nearUpVector;
 		Vector3 nearBottom = centreNear + nearDownVector;
 
-		auto points = std::array<Vector4, 8>();
-		points[0] = CalculateLightSpaceFrustumCorner(farTop, rightVector, m_farWidth);
-		points[1] = CalculateLightSpaceFrustumCorner(farTop, leftVector, m_farWidth);
-		points[2] = CalculateLightSpaceFrustumCorner(farBottom, rightVector, m_farWidth);
-		points[3] = CalculateLightSpaceFrustumCorner(farBottom, leftVector, m_farWidth);
-		points[4] = CalculateLightSpaceFrustumCorner(nearTop, rightVector, m_nearWidth);
-		points[5] = CalculateLightSpaceFrustumCorner(nearTop, leftVector, m_nearWidth);
-		points[6] = CalculateLightSpaceFrustumCorner(nearBottom, rightVector, m_nearWidth);
-		points[7] = CalculateLightSpaceFrustumCorner(nearBottom, leftVector, m_nearWidth);
+		auto points = std::array<Vector3, 8>();
+		points[0] = farTop + (rightVector * m_farWidth);
+		points[1] = farTop + (leftVector * m_farWidth);
+		points[2] = farBottom + (rightVector * m_farWidth);
+		points[3] = farBottom + (leftVector * m_farWidth);
+		points[4] = nearTop + (rightVector * m_nearWidth);
+		points[5] = nearTop + (leftVector * m_nearWidth);
+		points[6] = nearBottom + (rightVector * m_nearWidth);
+		points[7] = nearBottom + (leftVector * m_nearWidth);
 		return points;
 	}
 
-	Vector4 ShadowBox::CalculateLightSpaceFrustumCorner(const Vector3 &startPoint, const Vector3 &direction, const float &width)
-	{
-		Vector3 point = startPoint + (direction * width);
-		Vector4 point4 = Vector4(point);
-		point4 = m_lightViewMatrix.Transform(point4);
-		return point4;
-	}
-
 	void ShadowBox::UpdateOrthoProjectionMatrix()
 	{
 		m_projectionMatrix = Matrix4::IDENTITY;
@@ -62,25 +62,15 @@ namespace acid
 		void UpdateSizes(const Camera &camera);
 
 		/// <summary>
-		/// Calculates the vertex of each corner of the view frustum in light space.
+		/// Calculates the vertex of each corner of the view frustum in world space.
 		/// </summary>
 		/// <param name="rotation"> - camera's rotation. </param>
 		/// <param name="forwardVector"> - the direction that the camera is aiming, and thus the direction of the frustum. </param>
 		/// <param name="centreNear"> - the centre point of the frustum's near plane. </param>
 		/// <param name="centreFar"> - the centre point of the frustum's far plane.
 		/// </param>
-		/// <returns> The vertices of the frustum in light space. </returns>
-		std::array<Vector4, 8> CalculateFrustumVertices(const Matrix4 &rotation, const Vector3 &forwardVector, const Vector3 &centreNear, const Vector3 &centreFar);
-
-		/// <summary>
-		/// Calculates one of the corner vertices of the view frustum in world space and converts it to light space.
-		/// </summary>
-		/// <param name="startPoint"> The starting centre point on the view frustum. </param>
-		/// <param name="direction"> The direction of the corner from the start point. </param>
-		/// <param name="width"> The distance of the corner from the start point.
-		/// </param>
-		/// <returns> The relevant corner vertex of the view frustum in light space. </returns>
-		Vector4 CalculateLightSpaceFrustumCorner(const Vector3 &startPoint, const Vector3 &direction, const float &width);
+		/// <returns> The vertices of the frustum in world space. </returns>
+		std::array<Vector3, 8> CalculateFrustumVertices(const Matrix4 &rotation, const Vector3 &forwardVector, const Vector3 &centreNear, const Vector3 &centreFar);
 
 		void UpdateOrthoProjectionMatrix();
 
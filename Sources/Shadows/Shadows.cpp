@@ -15,6 +15,8 @@ namespace acid
 		m_shadowBoxDistance(70.0f),
 		m_shadowBox(ShadowBox())
 	{
+		Reads<Scenes>();
+		Writes<Shadows>();
 	}
 
 	void Shadows::Update()
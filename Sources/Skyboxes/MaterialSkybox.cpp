@@ -22,10 +22,6 @@ namespace acid
 			PIPELINE_MODE_MRT, PIPELINE_DEPTH_NONE, VK_POLYGON_MODE_FILL, VK_CULL_MODE_FRONT_BIT, false, {}));
 	}
 
-	void MaterialSkybox::Update()
-	{
-	}
-
 	void MaterialSkybox::Decode(const Metadata &metadata)
 	{
 		m_cubemap = Cubemap::Create(metadata.GetChild<std::string>("Cubemap Texture"), metadata.GetChild<std::string>("Cubemap Suffix"));
@@ -1,6 +1,7 @@
 ﻿#include "Cubemap.hpp"
 
 #include "Display/Display.hpp"
+#include "Engine/Profiler.hpp"
 #include "Helpers/String.hpp"
 #include "Maths/Maths.hpp"
 #include "Resources/Resources.hpp"
@@ -49,8 +50,16 @@ namespace acid
 		m_image(VK_NULL_HANDLE),
 		m_deviceMemory(VK_NULL_HANDLE),
 		m_imageView(VK_NULL_HANDLE),
+		m_sampler(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM)
 	{
+		if (!Resources::HasDevice())
+		{
+			return;
+		}
+
+		ACID_PROFILE_SCOPE("Cubemap::Load");
+
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
@@ -112,8 +121,14 @@ namespace acid
 		m_image(VK_NULL_HANDLE),
 		m_deviceMemory(VK_NULL_HANDLE),
 		m_imageView(VK_NULL_HANDLE),
+		m_sampler(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM)
 	{
+		if (!Resources::HasDevice())
+		{
+			return;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		m_mipLevels = mipmap ? Texture::GetMipLevels(m_width, m_height) : 1;
@@ -158,6 +173,11 @@ namespace acid
 
 	Cubemap::~Cubemap()
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		vkDestroySampler(logicalDevice, m_sampler, nullptr);
@@ -198,6 +218,11 @@ namespace acid
 
 	uint8_t *Cubemap::GetPixels(const uint32_t &arrayLayer)
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return nullptr;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		VkImage dstImage;
@@ -227,6 +252,11 @@ namespace acid
 
 	uint8_t *Cubemap::GetPixels()
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return nullptr;
+		}
+
 		auto result = (uint8_t *) malloc(m_width * m_height * 4 * 6);
 
 		for (uint32_t i = 0; i < 6; i++)
@@ -240,6 +270,11 @@ namespace acid
 
 	void Cubemap::SetPixels(uint8_t *pixels)
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		Buffer bufferStaging = Buffer(m_width * m_height * 4 * 6, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
@@ -1,6 +1,7 @@
 #include "Texture.hpp"
 
 #include "Display/Display.hpp"
+#include "Engine/Profiler.hpp"
 #include "Helpers/FileSystem.hpp"
 #include "Files/Files.hpp"
 #include "Maths/Maths.hpp"
@@ -51,8 +52,16 @@ namespace acid
 		m_image(VK_NULL_HANDLE),
 		m_deviceMemory(VK_NULL_HANDLE),
 		m_imageView(VK_NULL_HANDLE),
+		m_sampler(VK_NULL_HANDLE),
 		m_format(VK_FORMAT_R8G8B8A8_UNORM)
 	{
+		if (!Resources::HasDevice())
+		{
+			return;
+		}
+
+		ACID_PROFILE_SCOPE("Texture::Load");
+
 #if defined(ACID_VERBOSE)
 		auto debugStart = Engine::GetTime();
 #endif
@@ -117,6 +126,11 @@ namespace acid
 		m_sampler(VK_NULL_HANDLE),
 		m_format(format)
 	{
+		if (!Resources::HasDevice())
+		{
+			return;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		m_mipLevels = mipmap ? GetMipLevels(m_width, m_height) : 1;
@@ -161,6 +175,11 @@ namespace acid
 
 	Texture::~Texture()
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		vkDestroySampler(logicalDevice, m_sampler, nullptr);
@@ -201,6 +220,11 @@ namespace acid
 
 	uint8_t *Texture::GetPixels()
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return nullptr;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		VkImage dstImage;
@@ -230,6 +254,11 @@ namespace acid
 
 	void Texture::SetPixels(uint8_t *pixels)
 	{
+		if (m_image == VK_NULL_HANDLE)
+		{
+			return;
+		}
+
 		auto logicalDevice = Display::Get()->GetLogicalDevice();
 
 		Buffer bufferStaging = Buffer(m_width * m_height * 4, VK_BUFFER_USAGE_TRANSFER_SRC_BIT,
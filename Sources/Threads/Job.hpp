@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include "Engine/Exports.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A unit of work that is run by a job system, a job is finished once it and all of its children have run.
+	/// </summary>
+	class ACID_EXPORT Job
+	{
+	private:
+		friend class JobSystem;
+
+		std::function<void()> m_function;
+		std::shared_ptr<Job> m_parent;
+		std::atomic<int32_t> m_unfinished;
+		std::mutex m_mutex;
+		std::vector<std::shared_ptr<Job>> m_continuations;
+		bool m_finished;
+	public:
+		/// <summary>
+		/// Creates a new job.
+		/// </summary>
+		/// <param name="function"> The function to run, can be empty for a job that only groups children. </param>
+		/// <param name="parent"> The job that will not finish until this job has finished. </param>
+		explicit Job(std::function<void()> function, std::shared_ptr<Job> parent = nullptr) :
+			m_function(std::move(function)),
+			m_parent(std::move(parent)),
+			m_unfinished(1),
+			m_mutex(),
+			m_continuations(std::vector<std::shared_ptr<Job>>()),
+			m_finished(false)
+		{
+		}
+
+		Job(const Job&) = delete;
+
+		Job& operator=(const Job&) = delete;
+
+		/// <summary>
+		/// Gets if this job and all of its children have finished running.
+		/// </summary>
+		/// <returns> If the job is finished. </returns>
+		bool IsFinished() const { return m_unfinished.load(std::memory_order_acquire) <= 0; }
+	};
+
+	/// <summary>
+	/// A handle to a scheduled job, used to wait on the job or to chain continuations.
+	/// </summary>
+	class ACID_EXPORT JobHandle
+	{
+	private:
+		friend class JobSystem;
+
+		std::shared_ptr<Job> m_job;
+	public:
+		/// <summary>
+		/// Creates a new empty job handle, a empty handle is always finished.
+		/// </summary>
+		JobHandle() :
+			m_job(nullptr)
+		{
+		}
+
+		/// <summary>
+		/// Creates a new job handle.
+		/// </summary>
+		/// <param name="job"> The job to reference. </param>
+		explicit JobHandle(std::shared_ptr<Job> job) :
+			m_job(std::move(job))
+		{
+		}
+
+		/// <summary>
+		/// Gets if the referenced job has finished running.
+		/// </summary>
+		/// <returns> If the job is finished. </returns>
+		bool IsFinished() const { return m_job == nullptr || m_job->IsFinished(); }
+
+		bool IsValid() const { return m_job != nullptr; }
+	};
+
+	/// <summary>
+	/// A handle to a scheduled job that produces a value.
+	/// </summary>
+	/// <param name="T"> The type of value produced. </param>
+	template<typename T>
+	class JobFuture
+	{
+	private:
+		friend class JobSystem;
+
+		JobHandle m_handle;
+		std::shared_ptr<std::optional<T>> m_value;
+	public:
+		JobFuture(const JobHandle &handle, const std::shared_ptr<std::optional<T>> &value) :
+			m_handle(handle),
+			m_value(value)
+		{
+		}
+
+		/// <summary>
+		/// Gets if the value has been produced.
+		/// </summary>
+		/// <returns> If the value is ready. </returns>
+		bool IsFinished() const { return m_handle.IsFinished(); }
+
+		/// <summary>
+		/// Gets the handle of the job producing the value.
+		/// </summary>
+		/// <returns> The job handle. </returns>
+		const JobHandle &GetHandle() const { return m_handle; }
+
+		/// <summary>
+		/// Gets the produced value, only valid once <seealso cref="#IsFinished()"/> is true. Use <seealso cref="JobSystem#Get()"/> to wait for the value.
+		/// </summary>
+		/// <returns> The produced value. </returns>
+		const T &GetValue() const { return **m_value; }
+	};
+}
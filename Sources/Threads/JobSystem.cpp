@@ -0,0 +1,287 @@
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+namespace acid
+{
+	const uint32_t JobSystem::HARDWARE_CONCURRENCY = std::thread::hardware_concurrency();
+
+	static thread_local JobSystem *CURRENT_SYSTEM = nullptr;
+	static thread_local uint32_t CURRENT_WORKER = UINT32_MAX;
+
+	JobSystem::JobSystem(const uint32_t &workerCount) :
+		m_queues(std::vector<std::unique_ptr<WorkerQueue>>()),
+		m_workers(std::vector<std::thread>()),
+		m_queued(0),
+		m_sleeping(0),
+		m_nextQueue(0),
+		m_destroying(false),
+		m_sleepMutex(),
+		m_sleepCondition()
+	{
+		// There is always at least one queue, with no workers jobs are run by the thread waiting on them.
+		for (uint32_t i = 0; i < std::max(workerCount, 1u); i++)
+		{
+			m_queues.emplace_back(std::make_unique<WorkerQueue>());
+		}
+
+		for (uint32_t i = 0; i < workerCount; i++)
+		{
+			m_workers.emplace_back(&JobSystem::WorkerLoop, this, i);
+		}
+	}
+
+	JobSystem::~JobSystem()
+	{
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_destroying = true;
+		}
+
+		m_sleepCondition.notify_all();
+
+		for (auto &worker : m_workers)
+		{
+			worker.join();
+		}
+
+		// Runs any jobs left behind by the workers.
+		while (RunPending())
+		{
+		}
+	}
+
+	JobHandle JobSystem::Schedule(std::function<void()> function, const JobHandle &parent)
+	{
+		if (parent.m_job != nullptr)
+		{
+			parent.m_job->m_unfinished.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		auto job = std::make_shared<Job>(std::move(function), parent.m_job);
+		Submit(job);
+		return JobHandle(job);
+	}
+
+	JobHandle JobSystem::Then(const JobHandle &handle, std::function<void()> function)
+	{
+		auto job = std::make_shared<Job>(std::move(function));
+
+		if (handle.m_job != nullptr)
+		{
+			std::lock_guard<std::mutex> lock(handle.m_job->m_mutex);
+
+			if (!handle.m_job->m_finished)
+			{
+				handle.m_job->m_continuations.emplace_back(job);
+				return JobHandle(job);
+			}
+		}
+
+		Submit(job);
+		return JobHandle(job);
+	}
+
+	void JobSystem::Wait(const JobHandle &handle)
+	{
+		while (!handle.IsFinished())
+		{
+			if (!RunPending())
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	void JobSystem::ParallelFor(const uint32_t &begin, const uint32_t &end, const std::function<void(uint32_t, uint32_t)> &function, const uint32_t &grainSize)
+	{
+		if (end <= begin)
+		{
+			return;
+		}
+
+		uint32_t count = end - begin;
+		uint32_t grain = grainSize;
+
+		if (grain == 0)
+		{
+			// Splits into a few more ranges than there are threads so stealing can balance uneven ranges.
+			uint32_t splits = 4 * (GetWorkerCount() + 1);
+			grain = std::max((count + splits - 1) / splits, 1u);
+		}
+
+		if (count <= grain)
+		{
+			function(begin, end);
+			return;
+		}
+
+		// The root is never submitted, it is only used to track the children.
+		auto root = std::make_shared<Job>(nullptr);
+		JobHandle rootHandle = JobHandle(root);
+
+		for (uint32_t start = begin + grain; start < end; start += grain)
+		{
+			uint32_t stop = std::min(start + grain, end);
+			Schedule([&function, start, stop]()
+			{
+				function(start, stop);
+			}, rootHandle);
+		}
+
+		// The calling thread takes the first range itself.
+		function(begin, std::min(begin + grain, end));
+		Finish(root);
+		Wait(rootHandle);
+	}
+
+	bool JobSystem::IsWorkerThread() const
+	{
+		return CURRENT_SYSTEM == this && CURRENT_WORKER != UINT32_MAX;
+	}
+
+	void JobSystem::Submit(const std::shared_ptr<Job> &job)
+	{
+		uint32_t index;
+
+		if (IsWorkerThread())
+		{
+			index = CURRENT_WORKER;
+		}
+		else
+		{
+			index = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % static_cast<uint32_t>(m_queues.size());
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_queues[index]->m_mutex);
+			m_queues[index]->m_jobs.emplace_back(job);
+		}
+
+		m_queued.fetch_add(1);
+
+		if (m_sleeping.load() > 0)
+		{
+			std::lock_guard<std::mutex> lock(m_sleepMutex);
+			m_sleepCondition.notify_one();
+		}
+	}
+
+	std::shared_ptr<Job> JobSystem::Pop()
+	{
+		if (m_queued.load(std::memory_order_relaxed) == 0)
+		{
+			return nullptr;
+		}
+
+		uint32_t queueCount = static_cast<uint32_t>(m_queues.size());
+		uint32_t own = IsWorkerThread() ? CURRENT_WORKER : UINT32_MAX;
+
+		// Pops the newest job from our own queue, it is the most likely to be in cache.
+		if (own != UINT32_MAX)
+		{
+			auto &queue = *m_queues[own];
+			std::lock_guard<std::mutex> lock(queue.m_mutex);
+
+			if (!queue.m_jobs.empty())
+			{
+				auto job = std::move(queue.m_jobs.back());
+				queue.m_jobs.pop_back();
+				m_queued.fetch_sub(1);
+				return job;
+			}
+		}
+
+		// Steals the oldest job from another queue.
+		uint32_t start = own != UINT32_MAX ? own + 1 : m_nextQueue.load(std::memory_order_relaxed);
+
+		for (uint32_t i = 0; i < queueCount; i++)
+		{
+			uint32_t victim = (start + i) % queueCount;
+
+			if (victim == own)
+			{
+				continue;
+			}
+
+			auto &queue = *m_queues[victim];
+			std::lock_guard<std::mutex> lock(queue.m_mutex);
+
+			if (!queue.m_jobs.empty())
+			{
+				auto job = std::move(queue.m_jobs.front());
+				queue.m_jobs.pop_front();
+				m_queued.fetch_sub(1);
+				return job;
+			}
+		}
+
+		return nullptr;
+	}
+
+	bool JobSystem::RunPending()
+	{
+		auto job = Pop();
+
+		if (job == nullptr)
+		{
+			return false;
+		}
+
+		if (job->m_function)
+		{
+			job->m_function();
+		}
+
+		Finish(job);
+		return true;
+	}
+
+	void JobSystem::Finish(const std::shared_ptr<Job> &job)
+	{
+		if (job->m_unfinished.fetch_sub(1, std::memory_order_acq_rel) != 1)
+		{
+			return;
+		}
+
+		std::vector<std::shared_ptr<Job>> continuations;
+
+		{
+			std::lock_guard<std::mutex> lock(job->m_mutex);
+			job->m_finished = true;
+			continuations.swap(job->m_continuations);
+		}
+
+		for (auto &continuation : continuations)
+		{
+			Submit(continuation);
+		}
+
+		if (job->m_parent != nullptr)
+		{
+			Finish(job->m_parent);
+		}
+	}
+
+	void JobSystem::WorkerLoop(const uint32_t &index)
+	{
+		CURRENT_SYSTEM = this;
+		CURRENT_WORKER = index;
+
+		while (!m_destroying)
+		{
+			if (RunPending())
+			{
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(m_sleepMutex);
+			m_sleeping.fetch_add(1);
+			m_sleepCondition.wait(lock, [this]()
+			{
+				return m_queued.load() > 0 || m_destroying;
+			});
+			m_sleeping.fetch_sub(1);
+		}
+	}
+}
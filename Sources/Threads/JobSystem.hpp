@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "Engine/Exports.hpp"
+#include "Job.hpp"
+
+namespace acid
+{
+	/// <summary>
+	/// A work-stealing job scheduler. Every worker owns a deque, it pushes and pops its own jobs from the back and steals from the front of other workers when empty.
+	/// </summary>
+	class ACID_EXPORT JobSystem
+	{
+	private:
+		struct WorkerQueue
+		{
+			std::mutex m_mutex;
+			std::deque<std::shared_ptr<Job>> m_jobs;
+		};
+
+		std::vector<std::unique_ptr<WorkerQueue>> m_queues;
+		std::vector<std::thread> m_workers;
+		std::atomic<uint32_t> m_queued;
+		std::atomic<uint32_t> m_sleeping;
+		std::atomic<uint32_t> m_nextQueue;
+		std::atomic<bool> m_destroying;
+		std::mutex m_sleepMutex;
+		std::condition_variable m_sleepCondition;
+	public:
+		static const uint32_t HARDWARE_CONCURRENCY;
+
+		/// <summary>
+		/// Creates a new job system.
+		/// </summary>
+		/// <param name="workerCount"> The amount of worker threads, the thread calling <seealso cref="#Wait()"/> also runs jobs. </param>
+		explicit JobSystem(const uint32_t &workerCount = HARDWARE_CONCURRENCY > 1 ? HARDWARE_CONCURRENCY - 1 : 1);
+
+		JobSystem(const JobSystem&) = delete;
+
+		~JobSystem();
+
+		JobSystem& operator=(const JobSystem&) = delete;
+
+		/// <summary>
+		/// Schedules a function to be run on a worker.
+		/// </summary>
+		/// <param name="function"> The function to run. </param>
+		/// <param name="parent"> A job that will not finish until this job has finished, must not have finished yet. </param>
+		/// <returns> The handle to the scheduled job. </returns>
+		JobHandle Schedule(std::function<void()> function, const JobHandle &parent = JobHandle());
+
+		/// <summary>
+		/// Schedules a function to be run once another job has finished.
+		/// </summary>
+		/// <param name="handle"> The job to wait on. </param>
+		/// <param name="function"> The function to run. </param>
+		/// <returns> The handle to the continuation job. </returns>
+		JobHandle Then(const JobHandle &handle, std::function<void()> function);
+
+		/// <summary>
+		/// Schedules a function producing a value to be run on a worker.
+		/// </summary>
+		/// <param name="function"> The function to run. </param>
+		/// <param name="T"> The type of value produced. </param>
+		/// <returns> The future that will hold the value. </returns>
+		template<typename T>
+		JobFuture<T> Async(std::function<T()> function)
+		{
+			auto value = std::make_shared<std::optional<T>>();
+			auto handle = Schedule([value, function = std::move(function)]()
+			{
+				value->emplace(function());
+			});
+			return JobFuture<T>(handle, value);
+		}
+
+		/// <summary>
+		/// Waits for a future to be finished and gets the produced value.
+		/// </summary>
+		/// <param name="future"> The future to wait on. </param>
+		/// <param name="T"> The type of value produced. </param>
+		/// <returns> The produced value. </returns>
+		template<typename T>
+		const T &Get(const JobFuture<T> &future)
+		{
+			Wait(future.GetHandle());
+			return future.GetValue();
+		}
+
+		/// <summary>
+		/// Waits for a job to finish, the calling thread will run other jobs while waiting.
+		/// </summary>
+		/// <param name="handle"> The job to wait on. </param>
+		void Wait(const JobHandle &handle);
+
+		/// <summary>
+		/// Splits a index range into jobs and waits for all of them to finish.
+		/// </summary>
+		/// <param name="begin"> The first index. </param>
+		/// <param name="end"> The index after the last index. </param>
+		/// <param name="function"> The function run on each sub range, given the begin and end index of the sub range. </param>
+		/// <param name="grainSize"> The smallest amount of indices given to a job, 0 will split the range evenly over the workers. </param>
+		void ParallelFor(const uint32_t &begin, const uint32_t &end, const std::function<void(uint32_t, uint32_t)> &function, const uint32_t &grainSize = 0);
+
+		/// <summary>
+		/// Gets the amount of worker threads.
+		/// </summary>
+		/// <returns> The worker count. </returns>
+		uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_workers.size()); }
+
+		/// <summary>
+		/// Gets if the calling thread is a worker of this job system.
+		/// </summary>
+		/// <returns> If the calling thread is a worker. </returns>
+		bool IsWorkerThread() const;
+	private:
+		void Submit(const std::shared_ptr<Job> &job);
+
+		std::shared_ptr<Job> Pop();
+
+		bool RunPending();
+
+		void Finish(const std::shared_ptr<Job> &job);
+
+		void WorkerLoop(const uint32_t &index);
+	};
+}
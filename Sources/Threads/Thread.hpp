@@ -12,11 +12,12 @@ namespace acid
 	class ACID_EXPORT Thread
 	{
 	private:
-		std::thread m_worker;
 		std::queue<std::function<void()>> m_jobQueue;
 		std::mutex m_queueMutex;
 		std::condition_variable m_condition;
 		bool m_destroying = false;
+		// Declared last so the queue is constructed before the worker starts reading it.
+		std::thread m_worker;
 	public:
 		Thread();
 
@@ -8,7 +8,7 @@
 namespace acid
 {
 	/// <summary>
-	/// A pool of threads.
+	/// A pool of threads, jobs are not balanced between threads. Prefer <seealso cref="JobSystem"/> for new code.
 	/// </summary>
 	class ACID_EXPORT ThreadPool
 	{
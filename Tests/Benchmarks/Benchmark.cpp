@@ -0,0 +1,134 @@
+#include "Benchmark.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <Engine/Log.hpp>
+#include <Files/Json/FileJson.hpp>
+#include <Helpers/FileSystem.hpp>
+#include <Threads/JobSystem.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	Benchmark::Benchmark(const uint32_t &warmup, const uint32_t &repetitions, const std::string &filter) :
+		m_warmup(warmup),
+		m_repetitions(std::max(repetitions, 1u)),
+		m_filter(filter),
+		m_results(std::vector<BenchmarkResult>())
+	{
+	}
+
+	bool Benchmark::IsEnabled(const std::string &name) const
+	{
+		return m_filter.empty() || name.find(m_filter) != std::string::npos;
+	}
+
+	void Benchmark::Save(const std::string &filename, const std::string &label) const
+	{
+		FileJson file = FileJson(filename);
+		auto parent = file.GetParent();
+		parent->SetChild<std::string>("Label", label);
+		parent->SetChild<uint32_t>("Warmup", m_warmup);
+		parent->SetChild<uint32_t>("Repetitions", m_repetitions);
+		parent->SetChild<uint32_t>("Threads", JobSystem::HARDWARE_CONCURRENCY);
+
+		auto results = parent->AddChild(new Metadata("Results"));
+
+		for (auto &result : m_results)
+		{
+			auto child = results->AddChild(new Metadata(result.m_name));
+			child->SetChild<uint32_t>("Iterations", result.m_iterations);
+			child->SetChild<double>("Min", result.m_min);
+			child->SetChild<double>("Median", result.m_median);
+			child->SetChild<double>("Mean", result.m_mean);
+			child->SetChild<double>("Deviation", result.m_deviation);
+			child->SetChild<double>("Max", result.m_max);
+		}
+
+		file.Save();
+		Log::Out("Saved %i results to '%s'\n", static_cast<int32_t>(m_results.size()), filename.c_str());
+	}
+
+	std::optional<uint32_t> Benchmark::Compare(const std::string &filename, const float &threshold) const
+	{
+		if (!FileSystem::Exists(filename))
+		{
+			Log::Error("Benchmark baseline '%s' does not exist\n", filename.c_str());
+			return {};
+		}
+
+		FileJson file = FileJson(filename);
+		file.Load();
+
+		auto results = file.GetParent()->FindChild("Results", false);
+
+		if (results == nullptr)
+		{
+			Log::Error("Benchmark baseline '%s' could not be read or has no results\n", filename.c_str());
+			return {};
+		}
+
+		Log::Out("Compared to '%s' (%s):\n", filename.c_str(), file.GetParent()->GetChild<std::string>("Label").c_str());
+		uint32_t regressions = 0;
+
+		for (auto &result : m_results)
+		{
+			auto baseline = results->FindChild(result.m_name, false);
+
+			if (baseline == nullptr)
+			{
+				Log::Out("  %-48s new\n", result.m_name.c_str());
+				continue;
+			}
+
+			auto median = baseline->GetChild<double>("Median");
+
+			if (median <= 0.0)
+			{
+				continue;
+			}
+
+			auto change = 100.0 * (result.m_median - median) / median;
+			bool regressed = change > threshold;
+
+			if (regressed)
+			{
+				regressions++;
+			}
+
+			Log::Out("  %-48s %12.2f ns -> %12.2f ns %+8.2f%%%s\n", result.m_name.c_str(), median, result.m_median, change, regressed ? " REGRESSION" : "");
+		}
+
+		return regressions;
+	}
+
+	void Benchmark::AddResult(const std::string &name, const uint32_t &iterations, std::vector<double> &samples)
+	{
+		std::sort(samples.begin(), samples.end());
+
+		auto count = samples.size();
+		auto mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(count);
+		auto variance = 0.0;
+
+		for (auto &sample : samples)
+		{
+			variance += (sample - mean) * (sample - mean);
+		}
+
+		BenchmarkResult result = {};
+		result.m_name = name;
+		result.m_iterations = iterations;
+		result.m_repetitions = static_cast<uint32_t>(count);
+		result.m_min = samples.front();
+		result.m_median = count % 2 == 0 ? (samples[count / 2 - 1] + samples[count / 2]) / 2.0 : samples[count / 2];
+		result.m_mean = mean;
+		result.m_deviation = std::sqrt(variance / static_cast<double>(count));
+		result.m_max = samples.back();
+		m_results.emplace_back(result);
+
+		Log::Out("  %-48s median %12.2f ns  min %12.2f ns  dev %6.2f%%\n", name.c_str(), result.m_median, result.m_min,
+			mean > 0.0 ? 100.0 * result.m_deviation / mean : 0.0);
+	}
+}
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace test
+{
+	/// <summary>
+	/// The statistics of one benchmark, times are in nanoseconds per iteration.
+	/// </summary>
+	struct BenchmarkResult
+	{
+		std::string m_name;
+		uint32_t m_iterations;
+		uint32_t m_repetitions;
+		double m_min;
+		double m_median;
+		double m_mean;
+		double m_deviation;
+		double m_max;
+	};
+
+	/// <summary>
+	/// Runs timed benchmarks with warmup and repetitions, results can be saved as JSON and compared against a earlier run.
+	/// </summary>
+	class Benchmark
+	{
+	private:
+		using BenchmarkClock = std::chrono::steady_clock;
+
+		uint32_t m_warmup;
+		uint32_t m_repetitions;
+		std::string m_filter;
+		std::vector<BenchmarkResult> m_results;
+	public:
+		/// <summary>
+		/// Creates a new benchmark runner.
+		/// </summary>
+		/// <param name="warmup"> The untimed repetitions run before measuring. </param>
+		/// <param name="repetitions"> The timed repetitions the statistics are calculated from. </param>
+		/// <param name="filter"> Only benchmarks with names containing this are run, empty runs all. </param>
+		Benchmark(const uint32_t &warmup = 2, const uint32_t &repetitions = 10, const std::string &filter = "");
+
+		/// <summary>
+		/// Gets if a benchmark passes the filter, suites use this to skip expensive setup.
+		/// </summary>
+		/// <param name="name"> The benchmark name. </param>
+		/// <returns> If the benchmark will run. </returns>
+		bool IsEnabled(const std::string &name) const;
+
+		/// <summary>
+		/// Runs a benchmark, every repetition calls the function a number of times.
+		/// </summary>
+		/// <param name="name"> The benchmark name, written as "Suite/Case". </param>
+		/// <param name="iterations"> The calls per repetition. </param>
+		/// <param name="function"> The function being measured. </param>
+		template<typename F>
+		void Run(const std::string &name, const uint32_t &iterations, F &&function)
+		{
+			Run(name, iterations, []()
+			{
+			}, std::forward<F>(function));
+		}
+
+		/// <summary>
+		/// Runs a benchmark, every repetition calls the untimed setup then calls the function a number of times.
+		/// </summary>
+		/// <param name="name"> The benchmark name, written as "Suite/Case". </param>
+		/// <param name="iterations"> The calls per repetition. </param>
+		/// <param name="setup"> Resets state before each repetition, this is not timed. </param>
+		/// <param name="function"> The function being measured. </param>
+		template<typename S, typename F>
+		void Run(const std::string &name, const uint32_t &iterations, S &&setup, F &&function)
+		{
+			if (!IsEnabled(name))
+			{
+				return;
+			}
+
+			std::vector<double> samples;
+			samples.reserve(m_repetitions);
+
+			for (uint32_t i = 0; i < m_warmup + m_repetitions; i++)
+			{
+				setup();
+				auto start = BenchmarkClock::now();
+
+				for (uint32_t j = 0; j < iterations; j++)
+				{
+					function();
+				}
+
+				auto duration = std::chrono::duration<double, std::nano>(BenchmarkClock::now() - start);
+
+				if (i >= m_warmup)
+				{
+					samples.emplace_back(duration.count() / static_cast<double>(iterations));
+				}
+			}
+
+			AddResult(name, iterations, samples);
+		}
+
+		/// <summary>
+		/// Gets every result in the order they were run.
+		/// </summary>
+		/// <returns> The results. </returns>
+		const std::vector<BenchmarkResult> &GetResults() const { return m_results; }
+
+		/// <summary>
+		/// Writes the results as JSON.
+		/// </summary>
+		/// <param name="filename"> The file to write into. </param>
+		/// <param name="label"> A label stored with the results, like the commit being measured. </param>
+		void Save(const std::string &filename, const std::string &label) const;
+
+		/// <summary>
+		/// Compares the medians against results saved by a earlier run and logs the change.
+		/// </summary>
+		/// <param name="filename"> The saved results to compare against. </param>
+		/// <param name="threshold"> How much slower in percent a median can get before it counts as a regression. </param>
+		/// <returns> The amount of regressions, or nothing if the baseline could not be read. </returns>
+		std::optional<uint32_t> Compare(const std::string &filename, const float &threshold) const;
+
+		/// <summary>
+		/// Keeps a value from being optimized away.
+		/// </summary>
+		/// <param name="value"> The value to keep. </param>
+		template<typename T>
+		static void DoNotOptimize(const T &value)
+		{
+#if defined(ACID_BUILD_MSVC)
+			static volatile const void *sink;
+			sink = &value;
+#elif defined(ACID_BUILD_CLANG)
+			asm volatile("" : : "g"(value) : "memory");
+#else
+			asm volatile("" : : "r,m"(value) : "memory");
+#endif
+		}
+	private:
+		void AddResult(const std::string &name, const uint32_t &iterations, std::vector<double> &samples);
+	};
+}
@@ -0,0 +1,116 @@
+#include <Engine/Engine.hpp>
+#include <Files/Files.hpp>
+#include <Helpers/String.hpp>
+#include "Suites/Suites.hpp"
+#include "Benchmark.hpp"
+
+using namespace test;
+using namespace acid;
+
+static void PrintUsage()
+{
+	Log::Out("Usage: Benchmarks [options]\n");
+	Log::Out("  --filter <text>        Only runs benchmarks with names containing the text\n");
+	Log::Out("  --warmup <count>       Untimed repetitions before measuring, default 2\n");
+	Log::Out("  --repetitions <count>  Timed repetitions, default 10\n");
+	Log::Out("  --output <file>        Writes the results as JSON\n");
+	Log::Out("  --label <text>         A label saved with the results, like the commit\n");
+	Log::Out("  --compare <file>       Compares medians against saved results\n");
+	Log::Out("  --threshold <percent>  Slowdown counted as a regression, default 10\n");
+}
+
+int main(int argc, char **argv)
+{
+	std::string filter;
+	uint32_t warmup = 2;
+	uint32_t repetitions = 10;
+	std::string output;
+	std::string label;
+	std::string compare;
+	float threshold = 10.0f;
+
+	for (int32_t i = 1; i < argc; i++)
+	{
+		std::string argument = argv[i];
+
+		if (argument == "--help" || i + 1 >= argc)
+		{
+			PrintUsage();
+			return argument == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+		}
+
+		std::string value = argv[++i];
+
+		if (argument == "--filter")
+		{
+			filter = value;
+		}
+		else if (argument == "--warmup")
+		{
+			warmup = String::From<uint32_t>(value);
+		}
+		else if (argument == "--repetitions")
+		{
+			repetitions = String::From<uint32_t>(value);
+		}
+		else if (argument == "--output")
+		{
+			output = value;
+		}
+		else if (argument == "--label")
+		{
+			label = value;
+		}
+		else if (argument == "--compare")
+		{
+			compare = value;
+		}
+		else if (argument == "--threshold")
+		{
+			threshold = String::From<float>(value);
+		}
+		else
+		{
+			PrintUsage();
+			return EXIT_FAILURE;
+		}
+	}
+
+	// Benchmarks run on a headless engine, so they need no window or GPU and can run in CI.
+	Files::SetBaseDirectory(argv[0]);
+	auto engine = Engine(false, true);
+
+	Benchmark benchmark = Benchmark(warmup, repetitions, filter);
+	Log::Out("Benchmarks (%i warmup, %i repetitions):\n", warmup, repetitions);
+
+	SuiteThreads(benchmark);
+	SuiteModules(benchmark);
+	SuiteMemory(benchmark);
+	SuiteMaths(benchmark);
+	SuiteNoise(benchmark);
+	SuiteFiles(benchmark);
+	SuiteScenes(benchmark);
+	SuiteNetwork(benchmark);
+	SuiteParticles(benchmark);
+
+	if (!output.empty())
+	{
+		benchmark.Save(output, label);
+	}
+
+	std::optional<uint32_t> regressions = 0;
+
+	// A baseline that can not be read fails the run, so a regression gate never passes without comparing.
+	if (!compare.empty())
+	{
+		regressions = benchmark.Compare(compare, threshold);
+
+		if (regressions)
+		{
+			Log::Out("%i regressions over %.1f%%\n", *regressions, threshold);
+		}
+	}
+
+	Log::Flush();
+	return regressions && *regressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,132 @@
+#include "Suites.hpp"
+
+#include <cmath>
+#include <random>
+#include <sstream>
+#include <Files/Json/FileJson.hpp>
+#include <Files/Xml/FileXml.hpp>
+#include <Helpers/FileSystem.hpp>
+#include <Maths/Maths.hpp>
+#include <Models/Obj/ModelObj.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	static const std::string FILES_JSON = "Benchmarks/Document.json";
+	static const std::string FILES_XML = "Benchmarks/Document.xml";
+	static const std::string FILES_OBJ = "Benchmarks/Sphere.obj";
+	static const uint32_t DOCUMENT_ENTRIES = 1000;
+	static const uint32_t SPHERE_STACKS = 100;
+	static const uint32_t SPHERE_SLICES = 100;
+
+	static void FillDocument(Metadata *parent)
+	{
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+
+		auto entries = parent->AddChild(new Metadata("Entries"));
+
+		for (uint32_t i = 0; i < DOCUMENT_ENTRIES; i++)
+		{
+			auto entry = entries->AddChild(new Metadata("Entry" + std::to_string(i)));
+			entry->SetChild<std::string>("Name", "Entry " + std::to_string(i));
+			entry->SetChild<uint32_t>("Index", i);
+			entry->SetChild<bool>("Enabled", i % 2 == 0);
+
+			auto position = entry->AddChild(new Metadata("Position"));
+			position->SetChild<float>("x", distribution(generator));
+			position->SetChild<float>("y", distribution(generator));
+			position->SetChild<float>("z", distribution(generator));
+		}
+	}
+
+	/// <summary>
+	/// Writes a UV sphere as a OBJ with positions, uvs and normals.
+	/// </summary>
+	static void WriteSphere(const std::string &filename)
+	{
+		std::stringstream stream;
+
+		for (uint32_t i = 0; i <= SPHERE_STACKS; i++)
+		{
+			float theta = static_cast<float>(i) * PI / static_cast<float>(SPHERE_STACKS);
+
+			for (uint32_t j = 0; j <= SPHERE_SLICES; j++)
+			{
+				float phi = static_cast<float>(j) * 2.0f * PI / static_cast<float>(SPHERE_SLICES);
+				float x = std::cos(phi) * std::sin(theta);
+				float y = std::cos(theta);
+				float z = std::sin(phi) * std::sin(theta);
+				stream << "v " << x << " " << y << " " << z << "\n";
+				stream << "vt " << static_cast<float>(j) / SPHERE_SLICES << " " << static_cast<float>(i) / SPHERE_STACKS << "\n";
+				stream << "vn " << x << " " << y << " " << z << "\n";
+			}
+		}
+
+		for (uint32_t i = 0; i < SPHERE_STACKS; i++)
+		{
+			for (uint32_t j = 0; j < SPHERE_SLICES; j++)
+			{
+				uint32_t a = i * (SPHERE_SLICES + 1) + j + 1;
+				uint32_t b = a + SPHERE_SLICES + 1;
+				stream << "f " << a << "/" << a << "/" << a << " " << b << "/" << b << "/" << b << " " << a + 1 << "/" << a + 1 << "/" << a + 1 << "\n";
+				stream << "f " << b << "/" << b << "/" << b << " " << b + 1 << "/" << b + 1 << "/" << b + 1 << " " << a + 1 << "/" << a + 1 << "/" << a + 1 << "\n";
+			}
+		}
+
+		FileSystem::Create(filename);
+		FileSystem::WriteTextFile(filename, stream.str());
+	}
+
+	void SuiteFiles(Benchmark &benchmark)
+	{
+		if (benchmark.IsEnabled("Files/FileJson"))
+		{
+			FileJson file = FileJson(FILES_JSON);
+			FillDocument(file.GetParent());
+
+			benchmark.Run("Files/FileJson Save 1000", 10, [&]()
+			{
+				file.Save();
+			});
+
+			FileJson loaded = FileJson(FILES_JSON);
+
+			benchmark.Run("Files/FileJson Load 1000", 10, [&]()
+			{
+				loaded.Load();
+			});
+		}
+
+		if (benchmark.IsEnabled("Files/FileXml"))
+		{
+			FileXml file = FileXml(FILES_XML);
+			FillDocument(file.GetParent());
+
+			benchmark.Run("Files/FileXml Save 1000", 10, [&]()
+			{
+				file.Save();
+			});
+
+			FileXml loaded = FileXml(FILES_XML);
+
+			benchmark.Run("Files/FileXml Load 1000", 10, [&]()
+			{
+				loaded.Load();
+			});
+		}
+
+		if (benchmark.IsEnabled("Files/ModelObj"))
+		{
+			WriteSphere(FILES_OBJ);
+
+			// Models are constructed directly so the resource cache is not used, a headless engine only parses and calculates bounds.
+			benchmark.Run("Files/ModelObj Load 20k triangles", 5, [&]()
+			{
+				ModelObj model = ModelObj(FILES_OBJ);
+				Benchmark::DoNotOptimize(model.GetRadius());
+			});
+		}
+	}
+}
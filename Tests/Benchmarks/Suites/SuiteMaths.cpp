@@ -0,0 +1,352 @@
+#include "Suites.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <Engine/Log.hpp>
+#include <Maths/Batch.hpp>
+#include <Maths/Matrix4.hpp>
+#include <Maths/Quaternion.hpp>
+#include <Maths/RandomStream.hpp>
+#include <Maths/Transform.hpp>
+#include <Maths/Vector3.hpp>
+#include <Maths/Vector4.hpp>
+#include <Physics/Aabb.hpp>
+#include <Physics/Frustum.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	// Inputs are cycled through so results can not be hoisted out of the loop.
+	static const uint32_t INPUT_COUNT = 1024;
+	static const uint32_t INPUT_MASK = INPUT_COUNT - 1;
+	static const uint32_t MATHS_ITERATIONS = 1000000;
+	static const uint32_t BATCH_ITERATIONS = 2000;
+	static const uint32_t CULL_COUNT = 100000;
+	static const uint32_t CULL_ITERATIONS = 50;
+
+	/// <summary>
+	/// Logs a error if transforms, transformation matrices and batches build different matrices from the same rotations.
+	/// </summary>
+	static void CheckTransformationMatrices(const std::vector<Vector3> &vectors, const std::vector<Quaternion> &quaternions)
+	{
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(0.5f, 2.0f);
+
+		std::vector<Vector3> scales(INPUT_COUNT);
+		std::vector<Matrix4> batched(INPUT_COUNT);
+
+		for (uint32_t j = 0; j < INPUT_COUNT; j++)
+		{
+			scales[j] = Vector3(distribution(generator), distribution(generator), distribution(generator));
+		}
+
+		Batch::TransformationMatrices(vectors.data(), quaternions.data(), scales.data(), batched.data(), INPUT_COUNT);
+		float difference = 0.0f;
+
+		for (uint32_t j = 0; j < INPUT_COUNT; j++)
+		{
+			// Euler angles are turned into quaternions by transforms, so they are compared with the euler transformation matrix too.
+			auto euler = vectors[(j + 1) & INPUT_MASK] * 18.0f;
+			std::pair<Matrix4, Matrix4> pairs[3] = {
+				{Transform(vectors[j], quaternions[j], scales[j]).GetWorldMatrix(), Matrix4::TransformationMatrix(vectors[j], quaternions[j], scales[j])},
+				{Transform(vectors[j], quaternions[j], scales[j]).GetWorldMatrix(), batched[j]},
+				{Transform(vectors[j], euler, scales[j]).GetWorldMatrix(), Matrix4::TransformationMatrix(vectors[j], euler, scales[j])}
+			};
+
+			for (auto &pair : pairs)
+			{
+				for (uint32_t row = 0; row < 4; row++)
+				{
+					for (uint32_t col = 0; col < 4; col++)
+					{
+						difference = std::max(difference, std::abs(pair.first[row][col] - pair.second[row][col]));
+					}
+				}
+			}
+		}
+
+		if (difference > 0.001f)
+		{
+			Log::Error("Transformation matrices differ by up to %f\n", difference);
+		}
+	}
+
+	void SuiteMaths(Benchmark &benchmark)
+	{
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+
+		std::vector<Vector3> vectors(INPUT_COUNT);
+		std::vector<Vector4> vectors4(INPUT_COUNT);
+		std::vector<Quaternion> quaternions(INPUT_COUNT);
+		std::vector<Matrix4> matrices(INPUT_COUNT);
+
+		for (uint32_t i = 0; i < INPUT_COUNT; i++)
+		{
+			vectors[i] = Vector3(distribution(generator), distribution(generator), distribution(generator)) * 10.0f;
+			vectors4[i] = Vector4(vectors[i], 1.0f);
+			quaternions[i] = Quaternion(distribution(generator), distribution(generator), distribution(generator), distribution(generator)).Normalize();
+			matrices[i] = Matrix4::TransformationMatrix(vectors[i], quaternions[i], Vector3::ONE * (1.0f + 0.5f * distribution(generator)));
+		}
+
+		uint32_t i = 0;
+
+		benchmark.Run("Maths/Matrix4 Multiply", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(matrices[i & INPUT_MASK] * matrices[(i + 1) & INPUT_MASK]);
+			i++;
+		});
+		benchmark.Run("Maths/Matrix4 Transform", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(matrices[i & INPUT_MASK].Transform(vectors4[(i + 1) & INPUT_MASK]));
+			i++;
+		});
+		benchmark.Run("Maths/Matrix4 Invert", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(matrices[i & INPUT_MASK].Invert());
+			i++;
+		});
+		benchmark.Run("Maths/Matrix4 Transpose", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(matrices[i & INPUT_MASK].Transpose());
+			i++;
+		});
+		benchmark.Run("Maths/Matrix4 TransformationMatrix", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(Matrix4::TransformationMatrix(vectors[i & INPUT_MASK], quaternions[i & INPUT_MASK], Vector3::ONE));
+			i++;
+		});
+		benchmark.Run("Maths/Matrix4 ViewMatrix", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(Matrix4::ViewMatrix(vectors[i & INPUT_MASK], vectors[(i + 1) & INPUT_MASK]));
+			i++;
+		});
+		benchmark.Run("Maths/Quaternion Multiply", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(quaternions[i & INPUT_MASK] * quaternions[(i + 1) & INPUT_MASK]);
+			i++;
+		});
+		benchmark.Run("Maths/Quaternion Multiply Vector3", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(quaternions[i & INPUT_MASK] * vectors[(i + 1) & INPUT_MASK]);
+			i++;
+		});
+		benchmark.Run("Maths/Quaternion Slerp", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(quaternions[i & INPUT_MASK].Slerp(quaternions[(i + 1) & INPUT_MASK], 0.5f));
+			i++;
+		});
+		benchmark.Run("Maths/Quaternion Normalize", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(quaternions[i & INPUT_MASK].Normalize());
+			i++;
+		});
+		benchmark.Run("Maths/Quaternion ToRotationMatrix", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(quaternions[i & INPUT_MASK].ToRotationMatrix());
+			i++;
+		});
+		benchmark.Run("Maths/Quaternion From Matrix4", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(Quaternion(matrices[i & INPUT_MASK]));
+			i++;
+		});
+
+		CheckTransformationMatrices(vectors, quaternions);
+
+		std::vector<Transform> transforms(INPUT_COUNT);
+
+		for (uint32_t j = 0; j < INPUT_COUNT; j++)
+		{
+			transforms[j] = Transform(vectors[j], vectors[(j + 1) & INPUT_MASK] * 18.0f, Vector3::ONE * (1.0f + 0.5f * distribution(generator)));
+		}
+
+		// Each transform is moved before its matrix is read, as a transform is when it changes every frame.
+		benchmark.Run("Maths/Transform GetWorldMatrix", MATHS_ITERATIONS, [&]()
+		{
+			auto &transform = transforms[i & INPUT_MASK];
+			transform.SetPosition(transform.GetPosition() + Vector3::ONE);
+			Benchmark::DoNotOptimize(transform.GetWorldMatrix());
+			i++;
+		});
+		benchmark.Run("Maths/Transform Multiply", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(transforms[i & INPUT_MASK] * transforms[(i + 1) & INPUT_MASK]);
+			i++;
+		});
+
+		// Each batch run goes through every input once, the loops it replaces are timed beside it.
+		std::vector<float> xs(INPUT_COUNT);
+		std::vector<float> ys(INPUT_COUNT);
+		std::vector<float> zs(INPUT_COUNT);
+		std::vector<Vector3> transformedVectors(INPUT_COUNT);
+		std::vector<Matrix4> transformedMatrices(INPUT_COUNT);
+		std::vector<Vector3> scales(INPUT_COUNT, Vector3::ONE);
+
+		for (uint32_t j = 0; j < INPUT_COUNT; j++)
+		{
+			xs[j] = vectors[j].m_x;
+			ys[j] = vectors[j].m_y;
+			zs[j] = vectors[j].m_z;
+		}
+
+		Vector3Soa points = {xs.data(), ys.data(), zs.data()};
+
+		benchmark.Run("Maths/Batch TransformPoints loop", BATCH_ITERATIONS, [&]()
+		{
+			auto &matrix = matrices[i & INPUT_MASK];
+
+			for (uint32_t j = 0; j < INPUT_COUNT; j++)
+			{
+				transformedVectors[j] = Vector3(matrix.Transform(Vector4(vectors[j], 1.0f)));
+			}
+
+			Benchmark::DoNotOptimize(transformedVectors[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch TransformPoints", BATCH_ITERATIONS, [&]()
+		{
+			Batch::TransformPoints(matrices[i & INPUT_MASK], vectors.data(), transformedVectors.data(), INPUT_COUNT);
+			Benchmark::DoNotOptimize(transformedVectors[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch TransformPoints SoA", BATCH_ITERATIONS, [&]()
+		{
+			Batch::TransformPoints(matrices[i & INPUT_MASK], points, points, INPUT_COUNT);
+			Benchmark::DoNotOptimize(xs[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch Multiply loop", BATCH_ITERATIONS, [&]()
+		{
+			auto &matrix = matrices[i & INPUT_MASK];
+
+			for (uint32_t j = 0; j < INPUT_COUNT; j++)
+			{
+				transformedMatrices[j] = matrix * matrices[j];
+			}
+
+			Benchmark::DoNotOptimize(transformedMatrices[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch Multiply", BATCH_ITERATIONS, [&]()
+		{
+			Batch::Multiply(matrices[i & INPUT_MASK], matrices.data(), transformedMatrices.data(), INPUT_COUNT);
+			Benchmark::DoNotOptimize(transformedMatrices[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch TransformationMatrices loop", BATCH_ITERATIONS, [&]()
+		{
+			for (uint32_t j = 0; j < INPUT_COUNT; j++)
+			{
+				transformedMatrices[j] = Matrix4::TransformationMatrix(vectors[j], quaternions[j], scales[j]);
+			}
+
+			Benchmark::DoNotOptimize(transformedMatrices[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch TransformationMatrices", BATCH_ITERATIONS, [&]()
+		{
+			Batch::TransformationMatrices(vectors.data(), quaternions.data(), scales.data(), transformedMatrices.data(), INPUT_COUNT);
+			Benchmark::DoNotOptimize(transformedMatrices[0]);
+			i++;
+		});
+		benchmark.Run("Maths/Batch TransformedBounds", BATCH_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(Batch::TransformedBounds(matrices[i & INPUT_MASK], vectors.data(), INPUT_COUNT));
+			i++;
+		});
+
+		// Objects are spread around a camera so about a third of them are inside its frustum.
+		Frustum frustum = Frustum();
+		frustum.Update(Matrix4::ViewMatrix(Vector3::ZERO, Vector3(0.0f, 30.0f, 0.0f)), Matrix4::PerspectiveMatrix(1.2f, 1.5f, 0.1f, 200.0f));
+		std::vector<Vector3> centres(CULL_COUNT);
+		std::vector<float> radii(CULL_COUNT);
+		std::vector<Aabb> bounds(CULL_COUNT);
+		std::vector<uint32_t> visible(Frustum::GetMaskWords(CULL_COUNT));
+
+		for (uint32_t j = 0; j < CULL_COUNT; j++)
+		{
+			centres[j] = Vector3(distribution(generator), distribution(generator), distribution(generator)) * 150.0f;
+			radii[j] = 2.0f + distribution(generator);
+			bounds[j] = Aabb(centres[j] - radii[j], centres[j] + radii[j]);
+		}
+
+		benchmark.Run("Maths/Frustum SphereInFrustum loop", CULL_ITERATIONS, [&]()
+		{
+			uint32_t count = 0;
+
+			for (uint32_t j = 0; j < CULL_COUNT; j++)
+			{
+				count += frustum.SphereInFrustum(centres[j], radii[j]);
+			}
+
+			Benchmark::DoNotOptimize(count);
+		});
+		benchmark.Run("Maths/Frustum CullSpheres", CULL_ITERATIONS, [&]()
+		{
+			frustum.CullSpheres(centres.data(), radii.data(), CULL_COUNT, visible.data());
+			Benchmark::DoNotOptimize(visible[0]);
+		});
+		benchmark.Run("Maths/Frustum CubeInFrustum loop", CULL_ITERATIONS, [&]()
+		{
+			uint32_t count = 0;
+
+			for (uint32_t j = 0; j < CULL_COUNT; j++)
+			{
+				count += frustum.CubeInFrustum(bounds[j].m_min, bounds[j].m_max);
+			}
+
+			Benchmark::DoNotOptimize(count);
+		});
+		benchmark.Run("Maths/Frustum CullAABBs", CULL_ITERATIONS, [&]()
+		{
+			frustum.CullAABBs(bounds.data(), CULL_COUNT, visible.data());
+			Benchmark::DoNotOptimize(visible[0]);
+		});
+
+		// The standard generator with a distribution made every call, as random values used to be drawn.
+		std::mt19937 standardGenerator(SUITE_SEED);
+		RandomStream stream = RandomStream(SUITE_SEED);
+		std::vector<float> randoms(INPUT_COUNT);
+
+		benchmark.Run("Maths/Random mt19937", MATHS_ITERATIONS, [&]()
+		{
+			std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+			Benchmark::DoNotOptimize(dist(standardGenerator));
+		});
+		benchmark.Run("Maths/Random Next", MATHS_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(stream.Next(-1.0f, 1.0f));
+		});
+		benchmark.Run("Maths/Random Next loop", BATCH_ITERATIONS, [&]()
+		{
+			for (uint32_t j = 0; j < INPUT_COUNT; j++)
+			{
+				randoms[j] = stream.Next(-1.0f, 1.0f);
+			}
+
+			Benchmark::DoNotOptimize(randoms[0]);
+		});
+		benchmark.Run("Maths/Random Fill", BATCH_ITERATIONS, [&]()
+		{
+			stream.Fill(randoms.data(), INPUT_COUNT, -1.0f, 1.0f);
+			Benchmark::DoNotOptimize(randoms[0]);
+		});
+		benchmark.Run("Maths/Random UnitVectorWithinCone loop", BATCH_ITERATIONS, [&]()
+		{
+			for (uint32_t j = 0; j < INPUT_COUNT; j++)
+			{
+				transformedVectors[j] = stream.NextUnitVectorWithinCone(Vector3::UP, 0.5f);
+			}
+
+			Benchmark::DoNotOptimize(transformedVectors[0]);
+		});
+		benchmark.Run("Maths/Random FillUnitVectorsWithinCone", BATCH_ITERATIONS, [&]()
+		{
+			stream.FillUnitVectorsWithinCone(transformedVectors.data(), INPUT_COUNT, Vector3::UP, 0.5f);
+			Benchmark::DoNotOptimize(transformedVectors[0]);
+		});
+	}
+}
@@ -0,0 +1,45 @@
+#include "Suites.hpp"
+
+#include <Maths/Vector4.hpp>
+#include <Memory/FrameArena.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	static const uint32_t MEMORY_ELEMENTS = 1024;
+	static const uint32_t MEMORY_VECTORS = 16;
+
+	/// <summary>
+	/// A frame of transient work, a few vectors are filled then the frame ends.
+	/// </summary>
+	template<typename V>
+	static void RunFrame()
+	{
+		for (uint32_t i = 0; i < MEMORY_VECTORS; i++)
+		{
+			V values;
+
+			for (uint32_t j = 0; j < MEMORY_ELEMENTS; j++)
+			{
+				values.emplace_back(static_cast<float>(j), 0.0f, 0.0f, 1.0f);
+			}
+
+			Benchmark::DoNotOptimize(values.data());
+		}
+
+		FrameArena::EndFrame();
+	}
+
+	void SuiteMemory(Benchmark &benchmark)
+	{
+		benchmark.Run("Memory/std::vector frame", 1000, []()
+		{
+			RunFrame<std::vector<Vector4>>();
+		});
+		benchmark.Run("Memory/FrameVector frame", 1000, []()
+		{
+			RunFrame<FrameVector<Vector4>>();
+		});
+	}
+}
@@ -0,0 +1,64 @@
+#include "Suites.hpp"
+
+#include <utility>
+#include <Engine/ModuleManager.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	template<uint32_t N>
+	class BenchmarkModule :
+		public Module
+	{
+	public:
+		void Update() override
+		{
+		}
+	};
+
+	template<typename T>
+	static T *FindModule(const std::vector<std::unique_ptr<Module>> &modules)
+	{
+		for (auto &module : modules)
+		{
+			auto casted = dynamic_cast<T *>(module.get());
+
+			if (casted != nullptr)
+			{
+				return casted;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template<uint32_t... N>
+	static void RunLookups(Benchmark &benchmark, std::integer_sequence<uint32_t, N...>)
+	{
+		using Last = BenchmarkModule<sizeof...(N) - 1>;
+
+		std::vector<std::unique_ptr<Module>> modules;
+		(modules.emplace_back(std::make_unique<BenchmarkModule<N>>()), ...);
+
+		benchmark.Run("Modules/dynamic_cast scan 16", 1000000, [&]()
+		{
+			Benchmark::DoNotOptimize(modules);
+			Benchmark::DoNotOptimize(FindModule<Last>(modules));
+		});
+
+		ModuleManager moduleManager = ModuleManager();
+		(moduleManager.Add<BenchmarkModule<N>>(MODULE_UPDATE_NORMAL), ...);
+
+		benchmark.Run("Modules/ModuleManager Get 16", 1000000, [&]()
+		{
+			Benchmark::DoNotOptimize(moduleManager);
+			Benchmark::DoNotOptimize(moduleManager.Get<Last>());
+		});
+	}
+
+	void SuiteModules(Benchmark &benchmark)
+	{
+		RunLookups(benchmark, std::make_integer_sequence<uint32_t, 16>());
+	}
+}
@@ -0,0 +1,59 @@
+#include "Suites.hpp"
+
+#include <Maths/Quaternion.hpp>
+#include <Maths/Vector3.hpp>
+#include <Network/Packet.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	static const uint32_t PACKET_MESSAGES = 100000;
+
+	/// <summary>
+	/// A typical entity update message.
+	/// </summary>
+	static void WriteMessage(Packet &packet, const uint32_t &index)
+	{
+		packet << index;
+		packet << Vector3(static_cast<float>(index), 1.0f, 2.0f);
+		packet << Quaternion(0.0f, 0.0f, 0.0f, 1.0f);
+		packet << 100.0f;
+		packet << std::string("Entity");
+	}
+
+	void SuiteNetwork(Benchmark &benchmark)
+	{
+		Packet packet = Packet();
+		uint32_t index = 0;
+
+		benchmark.Run("Network/Packet Write", PACKET_MESSAGES, [&]()
+		{
+			packet.Clear();
+			index = 0;
+		}, [&]()
+		{
+			WriteMessage(packet, index++);
+		});
+		benchmark.Run("Network/Packet Read", PACKET_MESSAGES, [&]()
+		{
+			packet = Packet();
+
+			for (uint32_t i = 0; i < PACKET_MESSAGES; i++)
+			{
+				WriteMessage(packet, i);
+			}
+		}, [&]()
+		{
+			uint32_t id;
+			Vector3 position;
+			Quaternion rotation;
+			float health;
+			std::string name;
+			packet >> id >> position >> rotation >> health >> name;
+			Benchmark::DoNotOptimize(id);
+			Benchmark::DoNotOptimize(position);
+			Benchmark::DoNotOptimize(name);
+		});
+	}
+}
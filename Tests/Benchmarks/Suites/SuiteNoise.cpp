@@ -0,0 +1,39 @@
+#include "Suites.hpp"
+
+#include <Noise/Noise.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	static const uint32_t NOISE_ITERATIONS = 262144;
+
+	static void RunNoise(Benchmark &benchmark, const std::string &name, const NoiseType &type)
+	{
+		Noise noise = Noise(SUITE_SEED, 0.01f, NOISE_INTERP_QUINTIC, type);
+		uint32_t i = 0;
+
+		// Samples walk a 512x512 grid.
+		benchmark.Run("Noise/" + name + " 2D", NOISE_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(noise.GetNoise(static_cast<float>(i & 511), static_cast<float>(i >> 9)));
+			i++;
+		});
+		benchmark.Run("Noise/" + name + " 3D", NOISE_ITERATIONS, [&]()
+		{
+			Benchmark::DoNotOptimize(noise.GetNoise(static_cast<float>(i & 63), static_cast<float>((i >> 6) & 63), static_cast<float>(i >> 12)));
+			i++;
+		});
+	}
+
+	void SuiteNoise(Benchmark &benchmark)
+	{
+		RunNoise(benchmark, "Value", NOISE_TYPE_VALUE);
+		RunNoise(benchmark, "Perlin", NOISE_TYPE_PERLIN);
+		RunNoise(benchmark, "Perlin Fractal", NOISE_TYPE_PERLIN_FRACTAL);
+		RunNoise(benchmark, "Simplex", NOISE_TYPE_SIMPLEX);
+		RunNoise(benchmark, "Simplex Fractal", NOISE_TYPE_SIMPLEX_FRACTAL);
+		RunNoise(benchmark, "Cellular", NOISE_TYPE_CELLULAR);
+		RunNoise(benchmark, "Cubic", NOISE_TYPE_CUBIC);
+	}
+}
@@ -0,0 +1,159 @@
+#include "Suites.hpp"
+
+#include <algorithm>
+#include <random>
+#include <Memory/FrameArena.hpp>
+#include <Particles/Particles.hpp>
+#include <Scenes/Scenes.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	/// <summary>
+	/// A fixed camera looking into the particles, so camera distances, atlas offsets and frustum culling are measured.
+	/// </summary>
+	class ParticlesCamera :
+		public Camera
+	{
+	private:
+		Vector3 m_position;
+		Matrix4 m_viewMatrix;
+		Matrix4 m_projectionMatrix;
+		Frustum m_viewFrustum;
+	public:
+		ParticlesCamera() :
+			m_position(Vector3(0.0f, 0.0f, -15.0f)),
+			m_viewMatrix(Matrix4::ViewMatrix(m_position, Vector3::ZERO)),
+			m_projectionMatrix(Matrix4::PerspectiveMatrix(GetFov(), 16.0f / 9.0f, GetNearPlane(), GetFarPlane())),
+			m_viewFrustum(Frustum())
+		{
+			m_viewFrustum.Update(m_viewMatrix, m_projectionMatrix);
+		}
+
+		float GetFov() const override { return 60.0f; }
+
+		Frustum GetViewFrustum() const override { return m_viewFrustum; }
+
+		Matrix4 GetViewMatrix() const override { return m_viewMatrix; }
+
+		Matrix4 GetProjectionMatrix() const override { return m_projectionMatrix; }
+
+		Vector3 GetPosition() const override { return m_position; }
+	};
+
+	class ParticlesScene :
+		public Scene
+	{
+	public:
+		ParticlesScene() :
+			Scene(new ParticlesCamera(), nullptr)
+		{
+		}
+
+		void Start() override
+		{
+		}
+
+		void Update() override
+		{
+		}
+
+		bool IsPaused() const override { return false; }
+	};
+
+	static void RunParticles(Benchmark &benchmark, const uint32_t &particleCount, const uint32_t &iterations)
+	{
+		auto suffix = " " + std::to_string(particleCount / 1000) + "k";
+		auto nameSimulate = "Particles/Simulate" + suffix;
+		auto nameInstances = "Particles/Sort and instance data" + suffix;
+
+		if (!benchmark.IsEnabled(nameSimulate) && !benchmark.IsEnabled(nameInstances))
+		{
+			return;
+		}
+
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(-10.0f, 10.0f);
+
+		// Particles are split over a few types, like several emitters would. The textures are only named, a headless engine loads no pixels.
+		std::vector<std::shared_ptr<ParticleType>> types;
+
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			types.emplace_back(ParticleType::Create(Texture::Create("Particles/Benchmark.png"), 4, Colour::WHITE, 10.0f + static_cast<float>(i)));
+		}
+
+		auto createParticles = [&]()
+		{
+			std::vector<Particle> result;
+			result.reserve(particleCount);
+
+			for (uint32_t i = 0; i < particleCount; i++)
+			{
+				Vector3 position = Vector3(distribution(generator), distribution(generator), distribution(generator));
+				Vector3 velocity = Vector3(distribution(generator), distribution(generator), distribution(generator));
+				result.emplace_back(types[i % types.size()], position, velocity, 10.0f, 1.0f, 0.0f, 1.0f, 1.0f);
+			}
+
+			return result;
+		};
+
+		auto particles = Particles::Get();
+
+		// Simulating runs through the Particles module, a headless engine stops there.
+		benchmark.Run(nameSimulate, iterations, [&]()
+		{
+			particles->Clear();
+
+			for (auto &particle : createParticles())
+			{
+				particles->AddParticle(particle);
+			}
+		}, [&]()
+		{
+			particles->Update();
+		});
+
+		particles->Clear();
+
+		// The rest of the rendered path, run per type the same as Particles does with a renderer.
+		std::vector<std::vector<Particle>> typeParticles(types.size());
+
+		benchmark.Run(nameInstances, iterations, [&]()
+		{
+			for (auto &list : typeParticles)
+			{
+				list.clear();
+			}
+
+			for (auto &particle : createParticles())
+			{
+				particle.Update();
+				auto index = std::find(types.begin(), types.end(), particle.GetParticleType()) - types.begin();
+				typeParticles[index].emplace_back(particle);
+			}
+		}, [&]()
+		{
+			for (uint32_t i = 0; i < types.size(); i++)
+			{
+				std::sort(typeParticles[i].begin(), typeParticles[i].end());
+				types[i]->Update(typeParticles[i]);
+			}
+
+			// Every call is a frame, so the instance data is allocated from a fresh frame like it is when rendering.
+			FrameArena::EndFrame();
+		});
+	}
+
+	void SuiteParticles(Benchmark &benchmark)
+	{
+		// Particles measure the camera of the current scene, without one their update stops before any camera work.
+		Scenes::Get()->SetScene(new ParticlesScene());
+
+		RunParticles(benchmark, 10000, 20);
+		RunParticles(benchmark, 100000, 5);
+
+		Scenes::Get()->SetScene(nullptr);
+	}
+}
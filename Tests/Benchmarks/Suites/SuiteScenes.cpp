@@ -0,0 +1,624 @@
+#include "Suites.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <utility>
+#include <Memory/FrameArena.hpp>
+#include <Scenes/ComponentRegister.hpp>
+#include <Scenes/EntityCommandBuffer.hpp>
+#include <Scenes/SceneStructure.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	class BenchmarkHealth :
+		public Component
+	{
+	private:
+		float m_health;
+	public:
+		BenchmarkHealth() :
+			m_health(100.0f)
+		{
+		}
+
+		float GetHealth() const { return m_health; }
+	};
+
+	class BenchmarkVelocity :
+		public Component
+	{
+	private:
+		Vector3 m_velocity;
+	public:
+		BenchmarkVelocity() :
+			m_velocity(Vector3::ONE)
+		{
+		}
+
+		const Vector3 &GetVelocity() const { return m_velocity; }
+	};
+
+	class BenchmarkTag :
+		public Component
+	{
+	};
+
+	template<uint32_t N>
+	class BenchmarkFiller :
+		public Component
+	{
+	};
+
+	class BenchmarkShape :
+		public Component
+	{
+	public:
+		virtual float GetVolume() const = 0;
+	};
+
+	class BenchmarkSphere :
+		public BenchmarkShape
+	{
+	public:
+		float GetVolume() const override { return 1.0f; }
+	};
+
+	class BenchmarkBounds :
+		public Component
+	{
+	public:
+		std::optional<Aabb> GetBounds() const override
+		{
+			auto position = GetParent()->GetWorldTransform().GetPosition();
+			return Aabb(position - 1.0f, position + 1.0f);
+		}
+	};
+
+	class BenchmarkEnemy :
+		public Component
+	{
+	private:
+		float m_health;
+		float m_speed;
+		Vector3 m_spawn;
+		std::string m_faction;
+	public:
+		BenchmarkEnemy() :
+			m_health(0.0f),
+			m_speed(0.0f),
+			m_spawn(Vector3()),
+			m_faction("")
+		{
+		}
+
+		void Decode(const Metadata &metadata) override
+		{
+			m_health = metadata.GetChild<float>("Health");
+			m_speed = metadata.GetChild<float>("Speed");
+			m_spawn = metadata.GetChild<Vector3>("Spawn");
+			m_faction = metadata.GetChild<std::string>("Faction");
+		}
+
+		float GetHealth() const { return m_health; }
+	};
+
+	class BenchmarkThink :
+		public Component
+	{
+	private:
+		float m_heading;
+	public:
+		BenchmarkThink() :
+			m_heading(0.0f)
+		{
+		}
+
+		void Update() override
+		{
+			// Enough work to stand in for a small behaviour, scaled by the time since it last ran.
+			for (uint32_t i = 0; i < 16; i++)
+			{
+				m_heading = std::fmod(m_heading + std::sin(m_heading + GetUpdateDelta().AsSeconds()), 6.28318f);
+			}
+		}
+
+		float GetHeading() const { return m_heading; }
+	};
+
+	template<typename T>
+	static T *FindComponent(const Entity &entity)
+	{
+		for (auto &component : entity.GetComponents())
+		{
+			auto casted = dynamic_cast<T *>(component.get());
+
+			if (casted != nullptr)
+			{
+				return casted;
+			}
+		}
+
+		return nullptr;
+	}
+
+	template<uint32_t... N>
+	static void AddFillers(Entity &entity, std::integer_sequence<uint32_t, N...>)
+	{
+		(entity.AddComponent<BenchmarkFiller<N>>(), ...);
+	}
+
+	template<uint32_t... N>
+	static void RegisterFillers(ComponentRegister &componentRegister, std::vector<std::pair<std::string, bool (*)(Component *)>> &scan,
+		std::integer_sequence<uint32_t, N...>)
+	{
+		(componentRegister.Add<BenchmarkFiller<N>>("BenchmarkFiller" + std::to_string(N)), ...);
+		(scan.emplace_back("BenchmarkFiller" + std::to_string(N), [](Component *component)
+		{
+			return dynamic_cast<BenchmarkFiller<N> *>(component) != nullptr;
+		}), ...);
+	}
+
+	static void RunLookups(Benchmark &benchmark)
+	{
+		static const uint32_t entityCount = 1000;
+
+		// Every entity has a dozen components, the looked up ones are added last like a renderer usually is.
+		std::vector<std::unique_ptr<Entity>> entities;
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = std::make_unique<Entity>(Transform());
+			AddFillers(*entity, std::make_integer_sequence<uint32_t, 10>());
+			entity->AddComponent<BenchmarkHealth>();
+			entity->AddComponent<BenchmarkSphere>();
+			entities.emplace_back(std::move(entity));
+		}
+
+		benchmark.Run("Scenes/dynamic_cast scan 12 components", entityCount, [&, i = 0u]() mutable
+		{
+			Benchmark::DoNotOptimize(FindComponent<BenchmarkHealth>(*entities[i++ % entityCount]));
+		});
+		benchmark.Run("Scenes/GetComponent 12 components", entityCount, [&, i = 0u]() mutable
+		{
+			Benchmark::DoNotOptimize(entities[i++ % entityCount]->GetComponent<BenchmarkHealth>());
+		});
+		benchmark.Run("Scenes/dynamic_cast scan base 12 components", entityCount, [&, i = 0u]() mutable
+		{
+			Benchmark::DoNotOptimize(FindComponent<BenchmarkShape>(*entities[i++ % entityCount]));
+		});
+		benchmark.Run("Scenes/GetComponent base 12 components", entityCount, [&, i = 0u]() mutable
+		{
+			Benchmark::DoNotOptimize(entities[i++ % entityCount]->GetComponent<BenchmarkShape>());
+		});
+	}
+
+	static void RunRegister(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		if (!benchmark.IsEnabled("Scenes/ComponentRegister"))
+		{
+			return;
+		}
+
+		// Names are found for every component of every entity, like saving a scene does.
+		ComponentRegister componentRegister;
+		std::vector<std::pair<std::string, bool (*)(Component *)>> scan;
+		RegisterFillers(componentRegister, scan, std::make_integer_sequence<uint32_t, 32>());
+		std::vector<std::unique_ptr<Entity>> entities;
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = std::make_unique<Entity>(Transform());
+			AddFillers(*entity, std::make_integer_sequence<uint32_t, 12>());
+			entities.emplace_back(std::move(entity));
+		}
+
+		auto suffix = " " + std::to_string(entityCount) + "x12";
+
+		// How names were found before types were registered with a id, a dynamic_cast for each registered type.
+		benchmark.Run("Scenes/ComponentRegister dynamic_cast scan" + suffix, iterations, [&]()
+		{
+			std::size_t length = 0;
+
+			for (auto &entity : entities)
+			{
+				for (auto &component : entity->GetComponents())
+				{
+					for (auto &[name, isSame] : scan)
+					{
+						if (isSame(component.get()))
+						{
+							length += name.size();
+							break;
+						}
+					}
+				}
+			}
+
+			Benchmark::DoNotOptimize(length);
+		});
+		benchmark.Run("Scenes/ComponentRegister FindName" + suffix, iterations, [&]()
+		{
+			std::size_t length = 0;
+
+			for (auto &entity : entities)
+			{
+				for (auto &component : entity->GetComponents())
+				{
+					length += componentRegister.FindName(component.get())->size();
+				}
+			}
+
+			Benchmark::DoNotOptimize(length);
+		});
+	}
+
+	static void RunQueries(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		auto suffix = " " + std::to_string(entityCount / 1000) + "k";
+		std::vector<std::string> names = {"Scenes/QueryComponents all", "Scenes/QueryComponents half", "Scenes/QueryComponents tenth",
+			"Scenes/Each all", "Scenes/Each half", "Scenes/EachParallel half"};
+
+		if (std::none_of(names.begin(), names.end(), [&](const std::string &name)
+		{
+			return benchmark.IsEnabled(name + suffix);
+		}))
+		{
+			return;
+		}
+
+		// Every entity has health, half have a velocity and one in ten is tagged.
+		SceneStructure structure;
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = structure.CreateEntity(Transform(Vector3(static_cast<float>(i), 0.0f, 0.0f)));
+			entity->AddComponent<BenchmarkHealth>();
+
+			if (i % 2 == 0)
+			{
+				entity->AddComponent<BenchmarkVelocity>();
+			}
+
+			if (i % 10 == 0)
+			{
+				entity->AddComponent<BenchmarkTag>();
+			}
+		}
+
+		// Each queries collect their archetypes in the frame arena, ending frames between repetitions lets it be reused.
+		auto endFrame = []()
+		{
+			FrameArena::EndFrame();
+		};
+
+		benchmark.Run("Scenes/QueryComponents all" + suffix, iterations, endFrame, [&]()
+		{
+			Benchmark::DoNotOptimize(structure.QueryComponents<BenchmarkHealth>().size());
+		});
+		benchmark.Run("Scenes/QueryComponents half" + suffix, iterations, endFrame, [&]()
+		{
+			Benchmark::DoNotOptimize(structure.QueryComponents<BenchmarkVelocity>().size());
+		});
+		benchmark.Run("Scenes/QueryComponents tenth" + suffix, iterations, endFrame, [&]()
+		{
+			Benchmark::DoNotOptimize(structure.QueryComponents<BenchmarkTag>().size());
+		});
+		benchmark.Run("Scenes/Each all" + suffix, iterations, [&]()
+		{
+			float total = 0.0f;
+			structure.Each<BenchmarkHealth>([&](BenchmarkHealth &health)
+			{
+				total += health.GetHealth();
+			});
+			Benchmark::DoNotOptimize(total);
+		});
+		benchmark.Run("Scenes/Each half" + suffix, iterations, [&]()
+		{
+			structure.Each<Transform, BenchmarkVelocity>([](Transform &transform, BenchmarkVelocity &velocity)
+			{
+				transform.SetPosition(transform.GetPosition() + velocity.GetVelocity());
+			});
+		});
+		benchmark.Run("Scenes/EachParallel half" + suffix, iterations, [&]()
+		{
+			structure.EachParallel<Transform, BenchmarkVelocity>([](Transform &transform, BenchmarkVelocity &velocity)
+			{
+				transform.SetPosition(transform.GetPosition() + velocity.GetVelocity());
+			});
+		});
+	}
+
+	static void RunSpatial(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		auto suffix = " " + std::to_string(entityCount / 1000) + "k";
+		std::vector<std::string> names = {"Scenes/QuerySphere", "Scenes/Sphere scan", "Scenes/QueryFrustum", "Scenes/Update"};
+
+		if (std::none_of(names.begin(), names.end(), [&](const std::string &name)
+		{
+			return benchmark.IsEnabled(name + suffix);
+		}))
+		{
+			return;
+		}
+
+		// Entities are scattered through a 1000 unit cube, queries cover a small part of it like a camera in a open world would.
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(-500.0f, 500.0f);
+		SceneStructure structure;
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = structure.CreateEntity(Transform(Vector3(distribution(generator), distribution(generator), distribution(generator))));
+			entity->AddComponent<BenchmarkBounds>();
+		}
+
+		structure.Update();
+
+		Vector3 centre = Vector3(100.0f, 0.0f, 0.0f);
+		Frustum frustum = Frustum();
+		frustum.Update(Matrix4::ViewMatrix(Vector3::ZERO, Vector3::ZERO), Matrix4::PerspectiveMatrix(60.0f, 1.0f, 0.1f, 200.0f));
+
+		benchmark.Run("Scenes/QuerySphere" + suffix, iterations, [&]()
+		{
+			Benchmark::DoNotOptimize(structure.QuerySphere(centre, 50.0f).size());
+		});
+		benchmark.Run("Scenes/Sphere scan" + suffix, iterations, [&]()
+		{
+			uint32_t count = 0;
+
+			for (auto &entity : structure.QueryAll())
+			{
+				count += entity->GetBounds().Intersects(centre, 50.0f);
+			}
+
+			Benchmark::DoNotOptimize(count);
+		});
+		benchmark.Run("Scenes/QueryFrustum" + suffix, iterations, [&]()
+		{
+			Benchmark::DoNotOptimize(structure.QueryFrustum(frustum).size());
+		});
+		benchmark.Run("Scenes/Update" + suffix, iterations, [&]()
+		{
+			structure.Update();
+		});
+	}
+
+	static void RunTransforms(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		auto suffix = " " + std::to_string(entityCount / 1000) + "k";
+		std::vector<std::string> names = {"Scenes/TransformHierarchy idle", "Scenes/TransformHierarchy tenth moved", "Scenes/TransformHierarchy all moved",
+			"Scenes/GetWorldMatrix"};
+
+		if (std::none_of(names.begin(), names.end(), [&](const std::string &name)
+		{
+			return benchmark.IsEnabled(name + suffix);
+		}))
+		{
+			return;
+		}
+
+		// A quarter of the entities are roots, the rest are children of a random earlier entity so the hierarchy is a few levels deep.
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(-500.0f, 500.0f);
+		SceneStructure structure;
+		std::vector<Entity *> entities;
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			auto entity = structure.CreateEntity(Transform(Vector3(distribution(generator), distribution(generator), distribution(generator)),
+				Vector3(0.0f, distribution(generator), 0.0f)));
+
+			if (i % 4 != 0)
+			{
+				entity->SetParent(entities[generator() % entities.size()]);
+			}
+
+			entities.emplace_back(entity);
+		}
+
+		auto &hierarchy = structure.GetTransformHierarchy();
+		hierarchy.Update();
+
+		// Moves happen in the untimed setup, so the moved cases only update once per repetition.
+		auto moveEvery = [&](const uint32_t &step)
+		{
+			return [&, step, frame = 0.0f]() mutable
+			{
+				frame += 1.0f;
+
+				for (uint32_t i = 0; i < entityCount; i += step)
+				{
+					entities[i]->GetLocalTransform().SetEulerRotation(Vector3(0.0f, frame, 0.0f));
+				}
+			};
+		};
+
+		benchmark.Run("Scenes/TransformHierarchy idle" + suffix, iterations, [&]()
+		{
+			hierarchy.Update();
+		});
+		benchmark.Run("Scenes/TransformHierarchy tenth moved" + suffix, 1, moveEvery(10), [&]()
+		{
+			hierarchy.Update();
+		});
+		benchmark.Run("Scenes/TransformHierarchy all moved" + suffix, 1, moveEvery(1), [&]()
+		{
+			hierarchy.Update();
+		});
+		benchmark.Run("Scenes/GetWorldMatrix" + suffix, iterations, [&]()
+		{
+			float total = 0.0f;
+
+			for (auto &entity : entities)
+			{
+				total += entity->GetWorldMatrix()[3][0];
+			}
+
+			Benchmark::DoNotOptimize(total);
+		});
+	}
+
+	static void RunSpawning(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		auto suffix = " " + std::to_string(entityCount / 1000) + "k";
+
+		if (!benchmark.IsEnabled("Scenes/Spawn and remove 1000" + suffix) && !benchmark.IsEnabled("Scenes/Command buffer spawn and destroy 1000" + suffix))
+		{
+			return;
+		}
+
+		// Short lived entities like projectiles are created and removed while the rest of the scene stays.
+		SceneStructure structure;
+
+		for (uint32_t i = 0; i < entityCount; i++)
+		{
+			structure.CreateEntity(Transform(Vector3(static_cast<float>(i), 0.0f, 0.0f)));
+		}
+
+		structure.Update();
+		std::vector<EntityHandle> handles;
+		handles.reserve(1000);
+
+		benchmark.Run("Scenes/Spawn and remove 1000" + suffix, iterations, [&]()
+		{
+			for (uint32_t i = 0; i < 1000; i++)
+			{
+				handles.emplace_back(structure.CreateEntity(Transform(Vector3(static_cast<float>(i), 1.0f, 0.0f)))->GetHandle());
+			}
+
+			for (auto &handle : handles)
+			{
+				structure.Remove(handle);
+			}
+
+			handles.clear();
+		});
+
+		// The same changes recorded first, as a job would, and applied at the sync point.
+		EntityCommandBuffer commands;
+
+		benchmark.Run("Scenes/Command buffer spawn and destroy 1000" + suffix, iterations, [&]()
+		{
+			for (uint32_t i = 0; i < 1000; i++)
+			{
+				auto entity = commands.CreateEntity(Transform(Vector3(static_cast<float>(i), 1.0f, 0.0f)));
+				commands.AddComponent<BenchmarkHealth>(entity);
+			}
+
+			commands.Playback(structure);
+
+			for (auto health : structure.QueryComponents<BenchmarkHealth>())
+			{
+				commands.DestroyEntity(health->GetParent());
+			}
+
+			commands.Playback(structure);
+		});
+	}
+
+	static void RunPrefabs(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		if (!benchmark.IsEnabled("Scenes/Prefab decode") && !benchmark.IsEnabled("Scenes/Prefab clone"))
+		{
+			return;
+		}
+
+		ComponentRegister componentRegister;
+		componentRegister.Add<BenchmarkEnemy>("BenchmarkEnemy");
+
+		Metadata metadata("BenchmarkEnemy");
+		metadata.SetChild<float>("Health", 80.0f);
+		metadata.SetChild<float>("Speed", 4.5f);
+		metadata.SetChild<Vector3>("Spawn", Vector3(10.0f, 0.0f, -4.0f));
+		metadata.SetChild<std::string>("Faction", "Raiders");
+
+		// How a prefab spawned components before it was compiled, and how it copies its decoded template now.
+		auto prefabTemplate = std::unique_ptr<Component>(componentRegister.Create("BenchmarkEnemy"));
+		prefabTemplate->Decode(metadata);
+		auto clone = componentRegister.FindClone("BenchmarkEnemy");
+		std::vector<std::unique_ptr<Component>> components(entityCount);
+
+		benchmark.Run("Scenes/Prefab decode " + std::to_string(entityCount), iterations, [&]()
+		{
+			for (auto &component : components)
+			{
+				component.reset(componentRegister.Create("BenchmarkEnemy"));
+				component->Decode(metadata);
+			}
+		});
+		benchmark.Run("Scenes/Prefab clone " + std::to_string(entityCount), iterations, [&]()
+		{
+			for (auto &component : components)
+			{
+				component.reset(clone(prefabTemplate.get()));
+			}
+		});
+	}
+
+	static void RunUpdateRates(Benchmark &benchmark, const uint32_t &entityCount, const uint32_t &iterations)
+	{
+		auto suffix = " " + std::to_string(entityCount / 1000) + "k";
+		std::vector<std::string> names = {"Scenes/Update rate always", "Scenes/Update rate interval 4", "Scenes/Update rate distance",
+			"Scenes/Update without updates"};
+
+		if (std::none_of(names.begin(), names.end(), [&](const std::string &name)
+		{
+			return benchmark.IsEnabled(name + suffix);
+		}))
+		{
+			return;
+		}
+
+		std::mt19937 generator(SUITE_SEED);
+		std::uniform_real_distribution<float> distribution(-500.0f, 500.0f);
+
+		auto run = [&](const std::string &name, const UpdateRate &rate, const bool &think)
+		{
+			SceneStructure structure;
+			structure.SetViewPosition(Vector3::ZERO);
+
+			for (uint32_t i = 0; i < entityCount; i++)
+			{
+				auto entity = structure.CreateEntity(Transform(Vector3(distribution(generator), distribution(generator), distribution(generator))));
+
+				if (think)
+				{
+					entity->AddComponent<BenchmarkThink>()->SetUpdateRate(rate, 4, 100.0f);
+				}
+				else
+				{
+					entity->AddComponent<BenchmarkTag>();
+				}
+			}
+
+			// The first update starts the components, and components that do not update mark themselves.
+			structure.Update();
+
+			benchmark.Run(name + suffix, iterations, [&]()
+			{
+				structure.Update();
+			});
+		};
+
+		run("Scenes/Update rate always", UPDATE_RATE_ALWAYS, true);
+		run("Scenes/Update rate interval 4", UPDATE_RATE_INTERVAL, true);
+		run("Scenes/Update rate distance", UPDATE_RATE_DISTANCE, true);
+		run("Scenes/Update without updates", UPDATE_RATE_ALWAYS, false);
+	}
+
+	void SuiteScenes(Benchmark &benchmark)
+	{
+		RunLookups(benchmark);
+		RunRegister(benchmark, 1000, 20);
+		RunQueries(benchmark, 10000, 20);
+		RunQueries(benchmark, 100000, 5);
+		RunSpatial(benchmark, 100000, 20);
+		RunTransforms(benchmark, 100000, 20);
+		RunSpawning(benchmark, 100000, 20);
+		RunPrefabs(benchmark, 1000, 20);
+		RunUpdateRates(benchmark, 100000, 20);
+	}
+}
@@ -0,0 +1,84 @@
+#include "Suites.hpp"
+
+#include <atomic>
+#include <Threads/JobSystem.hpp>
+#include <Threads/ThreadPool.hpp>
+
+using namespace acid;
+
+namespace test
+{
+	static const uint32_t JOB_COUNT = 100000;
+	static const uint32_t JOB_WORK = 256;
+
+	static void DoWork(std::atomic<uint64_t> &sink)
+	{
+		uint64_t value = 0;
+
+		for (uint32_t i = 0; i < JOB_WORK; i++)
+		{
+			value += i * i;
+		}
+
+		sink.fetch_add(value, std::memory_order_relaxed);
+	}
+
+	void SuiteThreads(Benchmark &benchmark)
+	{
+		std::atomic<uint64_t> sink = 0;
+
+		// Each iteration runs every job, so times are per batch of jobs.
+		if (benchmark.IsEnabled("Threads/ThreadPool"))
+		{
+			ThreadPool threadPool = ThreadPool();
+			auto &threads = threadPool.GetThreads();
+
+			benchmark.Run("Threads/ThreadPool AddJob 100k", 1, [&]()
+			{
+				for (uint32_t i = 0; i < JOB_COUNT; i++)
+				{
+					threads[i % threads.size()]->AddJob([&sink]()
+					{
+						DoWork(sink);
+					});
+				}
+
+				threadPool.Wait();
+			});
+		}
+
+		if (benchmark.IsEnabled("Threads/JobSystem"))
+		{
+			JobSystem jobSystem = JobSystem();
+			std::vector<JobHandle> handles(JOB_COUNT);
+
+			benchmark.Run("Threads/JobSystem Schedule 100k", 1, [&]()
+			{
+				for (uint32_t i = 0; i < JOB_COUNT; i++)
+				{
+					handles[i] = jobSystem.Schedule([&sink]()
+					{
+						DoWork(sink);
+					});
+				}
+
+				for (auto &handle : handles)
+				{
+					jobSystem.Wait(handle);
+				}
+			});
+			benchmark.Run("Threads/JobSystem ParallelFor 100k", 1, [&]()
+			{
+				jobSystem.ParallelFor(0, JOB_COUNT, [&sink](uint32_t begin, uint32_t end)
+				{
+					for (uint32_t i = begin; i < end; i++)
+					{
+						DoWork(sink);
+					}
+				});
+			});
+		}
+
+		Benchmark::DoNotOptimize(sink.load());
+	}
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "Benchmark.hpp"
+
+namespace test
+{
+	/// <summary>
+	/// The seed used for generated inputs, so every run measures the same data.
+	/// </summary>
+	static const uint32_t SUITE_SEED = 1337;
+
+	void SuiteThreads(Benchmark &benchmark);
+
+	void SuiteModules(Benchmark &benchmark);
+
+	void SuiteMemory(Benchmark &benchmark);
+
+	void SuiteMaths(Benchmark &benchmark);
+
+	void SuiteNoise(Benchmark &benchmark);
+
+	void SuiteFiles(Benchmark &benchmark);
+
+	void SuiteScenes(Benchmark &benchmark);
+
+	void SuiteNetwork(Benchmark &benchmark);
+
+	void SuiteParticles(Benchmark &benchmark);
+}
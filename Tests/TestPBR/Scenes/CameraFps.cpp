@@ -75,7 +75,7 @@ namespace test
 
 		if (scenePlayer != nullptr)
 		{
-			auto playerRotation = scenePlayer->GetParent()->GetWorldTransform().GetRotation();
+			auto playerRotation = scenePlayer->GetParent()->GetWorldTransform().GetEulerRotation();
 			auto playerPosition = scenePlayer->GetParent()->GetWorldTransform().GetPosition();
 
 			m_velocity = (playerPosition - m_targetPosition) / delta;
@@ -34,7 +34,7 @@ namespace test
 		worldPosition.m_y += m_heightOffset;
 
 		m_transform.SetPosition(worldPosition);
-		m_transform.SetRotation(Vector3::ZERO);
+		m_transform.SetRotation(Quaternion::W_ONE);
 
 		// Quick way to change alpha values, only if you know the driver type for sure!
 		float toCamera = Scenes::Get()->GetCamera()->GetPosition().Distance(worldPosition);
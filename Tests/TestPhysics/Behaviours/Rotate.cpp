@@ -23,12 +23,12 @@ namespace test
 	{
 		m_rotation += m_direction * Engine::Get()->GetDelta().AsSeconds();
 		Transform &transform = GetParent()->GetLocalTransform();
-		transform.SetRotation(m_rotation);
+		transform.SetEulerRotation(m_rotation);
 
 		if (m_test == 1)
 		{
 			Quaternion rotation = Quaternion(m_rotation.m_x, m_rotation.m_y, m_rotation.m_z);
-			transform.SetRotation(rotation.ToEuler());
+			transform.SetRotation(rotation);
 		}
 		else if (m_test == 2)
 		{
@@ -77,7 +77,7 @@ namespace test
 		if (scenePlayer != nullptr)
 		{
 			auto playerPosition = scenePlayer->GetParent()->GetWorldTransform().GetPosition();
-		//	auto playerRotation = scenePlayer->GetParent()->GetWorldTransform().GetRotation();
+		//	auto playerRotation = scenePlayer->GetParent()->GetWorldTransform().GetEulerRotation();
 
 			m_velocity = (playerPosition - m_targetPosition) / delta;
 			m_targetPosition = playerPosition + Vector3(0.0f, VIEW_HEIGHT, 0.0f);
@@ -113,7 +113,7 @@ namespace test
 		auto &transform = GetParent()->GetLocalTransform();
 		auto cameraRotation = Scenes::Get()->GetCamera()->GetRotation();
 
-		transform.SetRotation(Vector3(0.0f, cameraRotation.m_y, 0.0f));
+		transform.SetEulerRotation(Vector3(0.0f, cameraRotation.m_y, 0.0f));
 
 		float theta = Maths::Radians(cameraRotation.m_y);
 		Vector3 walkDirection = direction;
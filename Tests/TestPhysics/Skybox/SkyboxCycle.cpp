@@ -43,12 +43,12 @@ namespace test
 		if (m_enableRotation)
 		{
 			materialSkybox->SetBlend(World::Get()->GetStarIntensity());
-			GetParent()->GetLocalTransform().SetRotation(World::Get()->GetSkyboxRotation());
+			GetParent()->GetLocalTransform().SetEulerRotation(World::Get()->GetSkyboxRotation());
 		}
 		else
 		{
 			materialSkybox->SetBlend(1.0f);
-			GetParent()->GetLocalTransform().SetRotation(Vector3::ZERO);
+			GetParent()->GetLocalTransform().SetRotation(Quaternion::W_ONE);
 		}
 	}
 
@@ -111,7 +111,7 @@ namespace test
 
 		auto cameraRotation = Scenes::Get()->GetCamera()->GetRotation();
 		Vector3 newPosition = GetParent()->GetLocalTransform().GetPosition();
-		Vector3 newRotation = GetParent()->GetLocalTransform().GetRotation();
+		Vector3 newRotation = GetParent()->GetLocalTransform().GetEulerRotation();
 
 		float groundHeight = 0.0f;
 
@@ -135,7 +135,7 @@ namespace test
 		}
 
 		GetParent()->GetLocalTransform().SetPosition(newPosition);
-		GetParent()->GetLocalTransform().SetRotation(newRotation);
+		GetParent()->GetLocalTransform().SetEulerRotation(newRotation);
 	}
 
 	void PlayerFps::Decode(const Metadata &metadata)